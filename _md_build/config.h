@@ -0,0 +1,183 @@
+/* config.h.  Generated from config.h.in by configure.  */
+/* config.h.in.  Generated from configure.ac by autoheader.  */
+
+/* Allocate the coefficients and the symbols of the affine forms from
+   size-class pools */
+/* #undef FLOAT_ALLOCATION_POOL */
+
+/* Define to used a simplified interface file */
+/* #undef FLOAT_ALLOW_INTERFACE */
+
+/* Define to allow read exceptions */
+/* #undef FLOAT_ALLOW_READ_EXCEPTION */
+
+/* Define to use long int for storing mantissa */
+#define FLOAT_GENERIC_BASE_LONG 1
+
+/* Define to use unsigned int for storing mantissa */
+/* #undef FLOAT_GENERIC_BASE_UNSIGNED */
+
+/* Define to derive the implementation value of the exact domain from the
+   native computations */
+#define FLOAT_LAZY_IMPLEMENTATION 1
+
+/* Define to write real numbers with the natural decimal writing */
+#define FLOAT_LONG_WRITE 1
+
+/* Define to represent the real numbers of the exact domain as unevaluated
+   sums of native doubles */
+#define FLOAT_MULTI_DOUBLE_REAL 1
+
+/* Define the number of bits for the mantissa of real numbers */
+/* #undef FLOAT_REAL_BITS_NUMBER */
+
+/* Push the constraints onto a stack to apply them in an optimal but costly
+   way */
+/* #undef FLOAT_ZONOTOPE_ALLOW_SIMPLEX */
+
+/* Enable the systematic absorption of high level symbols into standard noise
+   symbols */
+/* #undef FLOAT_ZONOTOPE_DOES_ABSORB_HIGH_LEVEL */
+
+/* Exclude the constant part in the definition of negligeable symbols for
+   their absorption into standard noise symbols */
+/* #undef FLOAT_ZONOTOPE_DOES_EXCLUDE_CONSTANT_FROM_SYMBOL_ABSORPTION */
+
+/* Iterate over contiguous snapshots of the affine forms in the quadratic
+   products */
+/* #undef FLOAT_ZONOTOPE_FLAT_EQUATION */
+
+/* Define the limit in binary digits from which a symbol is absorbed into a
+   standard noise symbol */
+/* #undef FLOAT_ZONOTOPE_LIMIT_SYMBOL_ABSORPTION */
+
+/* define if the compiler supports basic C++11 syntax */
+/* #undef HAVE_CXX11 */
+
+/* Whether C++ ABI functions are available */
+#define HAVE_CXXABI /**/
+
+/* Define to 1 if you have the <dlfcn.h> header file. */
+#define HAVE_DLFCN_H 1
+
+/* Define to 1 if you have the `fesetround' function. */
+#define HAVE_FESETROUND 1
+
+/* Define to 1 if you have the <float.h> header file. */
+#define HAVE_FLOAT_H 1
+
+/* Define to 1 if you have the `floor' function. */
+#define HAVE_FLOOR 1
+
+/* Define to 1 if you have the <inttypes.h> header file. */
+#define HAVE_INTTYPES_H 1
+
+/* Define to 1 if you have the `c' library (-lc). */
+#define HAVE_LIBC 1
+
+/* Define to 1 if you have the `m' library (-lm). */
+#define HAVE_LIBM 1
+
+/* Define to 1 if you have the <limits.h> header file. */
+#define HAVE_LIMITS_H 1
+
+/* Define to 1 if your system has a GNU libc compatible `malloc' function, and
+   to 0 otherwise. */
+#define HAVE_MALLOC 1
+
+/* Define to 1 if you have the `memmove' function. */
+#define HAVE_MEMMOVE 1
+
+/* Define to 1 if you have the <memory.h> header file. */
+#define HAVE_MEMORY_H 1
+
+/* Define to 1 if you have the `memset' function. */
+#define HAVE_MEMSET 1
+
+/* Define to 1 if you have the `pow' function. */
+#define HAVE_POW 1
+
+/* Define to 1 if your system has a GNU libc compatible `realloc' function,
+   and to 0 otherwise. */
+#define HAVE_REALLOC 1
+
+/* Define to 1 if you have the `rint' function. */
+#define HAVE_RINT 1
+
+/* Define to 1 if you have the `sqrt' function. */
+#define HAVE_SQRT 1
+
+/* Define to 1 if you have the <stddef.h> header file. */
+#define HAVE_STDDEF_H 1
+
+/* Define to 1 if you have the <stdint.h> header file. */
+#define HAVE_STDINT_H 1
+
+/* Define to 1 if you have the <stdlib.h> header file. */
+#define HAVE_STDLIB_H 1
+
+/* Define to 1 if you have the <strings.h> header file. */
+#define HAVE_STRINGS_H 1
+
+/* Define to 1 if you have the <string.h> header file. */
+#define HAVE_STRING_H 1
+
+/* Define to 1 if you have the <sys/stat.h> header file. */
+#define HAVE_SYS_STAT_H 1
+
+/* Define to 1 if you have the <sys/types.h> header file. */
+#define HAVE_SYS_TYPES_H 1
+
+/* Define to 1 if you have the <unistd.h> header file. */
+#define HAVE_UNISTD_H 1
+
+/* Define to 1 if the system has the type `_Bool'. */
+/* #undef HAVE__BOOL */
+
+/* Define to the sub-directory where libtool stores uninstalled libraries. */
+#define LT_OBJDIR ".libs/"
+
+/* Define to 1 if assertions should be disabled. */
+/* #undef NDEBUG */
+
+/* Name of package */
+#define PACKAGE "fldlib"
+
+/* Define to the address where bug reports for this package should be sent. */
+#define PACKAGE_BUGREPORT "franck.vedrine@cea.fr"
+
+/* Define to the full name of this package. */
+#define PACKAGE_NAME "FLDLib"
+
+/* Define to the full name and version of this package. */
+#define PACKAGE_STRING "FLDLib 0.9.0"
+
+/* Define to the one symbol short name of this package. */
+#define PACKAGE_TARNAME "fldlib"
+
+/* Define to the home page for this package. */
+#define PACKAGE_URL ""
+
+/* Define to the version of this package. */
+#define PACKAGE_VERSION "0.9.0"
+
+/* Define to 1 if you have the ANSI C header files. */
+#define STDC_HEADERS 1
+
+/* Version number of package */
+#define VERSION "0.9.0"
+
+/* Define to `__inline__' or `__inline' if that's what the C compiler
+   calls it, or to nothing if 'inline' is not supported under any name.  */
+#ifndef __cplusplus
+/* #undef inline */
+#endif
+
+/* Define to rpl_malloc if the replacement function should be used. */
+/* #undef malloc */
+
+/* Define to rpl_realloc if the replacement function should be used. */
+/* #undef realloc */
+
+/* Define to `unsigned int' if <sys/types.h> does not define. */
+/* #undef size_t */
@@ -0,0 +1,238 @@
+#!/bin/bash
+
+# -g -O2 -Wall
+
+if [ -z "${AUTOTEST}" ]
+then
+if [ -z "${FLOATDIAGNOSISHOME}" ]
+then
+   prefix=/usr/local
+   exec_prefix=${prefix}
+   FLOATDIAGNOSIS_INCLUDE=${prefix}/include/fldlib
+   FLOATDIAGNOSIS_LIB=${exec_prefix}/lib/fldlib
+   FLOATDIAGNOSIS_TESTS_INCLUDE=${FLOATDIAGNOSIS_INCLUDE}
+   FLOATDIAGNOSIS_ICONFIG_INCLUDE=-I${FLOATDIAGNOSIS_INCLUDE}
+else
+   FLOATDIAGNOSIS_INCLUDE=${FLOATDIAGNOSISHOME}/include/fldlib
+   FLOATDIAGNOSIS_TESTS_INCLUDE=${FLOATDIAGNOSIS_INCLUDE}
+   FLOATDIAGNOSIS_ICONFIG_INCLUDE=-I${FLOATDIAGNOSIS_INCLUDE}
+   FLOATDIAGNOSIS_LIB=${FLOATDIAGNOSISHOME}/lib/fldlib
+fi
+else
+   FLOATDIAGNOSIS_INCLUDE=../..
+   FLOATDIAGNOSIS_TESTS_INCLUDE=../../tests
+   FLOATDIAGNOSIS_ICONFIG_INCLUDE="-I.. -I../applications -I../tests"
+   FLOATDIAGNOSIS_LIB=../.libs
+fi
+
+cxxflags=" -DFLOAT_DIAGNOSIS -I${FLOATDIAGNOSIS_INCLUDE} \
+   -std=c++11  \
+   -DFLOAT_GENERIC_BASE_LONG  -DFLOAT_LONG_WRITE \
+      \
+     \
+     -DFLOAT_LAZY_IMPLEMENTATION -DFLOAT_MULTI_DOUBLE_REAL
+   ${FLOATDIAGNOSIS_ICONFIG_INCLUDE} -I${FLOATDIAGNOSIS_INCLUDE}/utils -I${FLOATDIAGNOSIS_INCLUDE}/algorithms \
+   -I${FLOATDIAGNOSIS_INCLUDE}/applications "
+
+opt_params_count=0
+
+loop_unstable=0
+optim=0
+verbose=0
+analysis=0
+interface=0
+has_include=0
+has_progname=0
+
+for param in "$@"
+do
+  if [ ${has_include} -ne 0 ]
+  then
+    ((opt_params_count++))
+    cxxflags+=${param}
+    has_include=0
+  elif [ "${param:0:1}" == "-" ]
+  then
+    ((opt_params_count++))
+    if [ "${param}" == "-include" ]
+    then
+      cxxflags+=" -include "
+      has_include=1
+    elif [ "${param}" == "-progname" ]
+    then
+      cxxflags+=" -DPROG_NAME="
+      has_include=1
+      has_progname=1
+    elif [ "${param}" == "-interval" ]
+    then
+      analysis=2
+    elif [ "${param}" == "-exact" ]
+    then
+      analysis=0
+    elif [ "${param}" == "-affine" ]
+    then
+      analysis=1
+    elif [ "${param}" == "-optim" ]
+    then
+      optim=1
+    elif [ "$param" == "-atomic" ]
+    then
+      cxxflags+=" -DFLOAT_ATOMIC"
+    elif [ "$param" == "-pure-zonotope" ]
+    then # keep maximal relationships among variables to the detriment of constraints
+      cxxflags+=" -DFLOAT_PURE_ZONOTOPE"
+    elif [ "$param" == "-track" ]
+    then # keep maximal relationships among variables to the detriment of constraints
+      cxxflags+=" -DFLOAT_TRACK"
+    elif [ "$param" == "-map-symbols" ]
+    then # keep maximal relationships among variables to the detriment of constraints
+      cxxflags+=" -DFLOAT_MAP_SYMBOLS"
+    elif [ "$param" == "-create-interval-trigger-percent" ]
+    then # Replace the zonotope by the interval if the interval is xxx% better than the zonotope
+      cxxflags+=" -DFLOAT_TRIGGER_PERCENT="
+      has_include=1
+    elif [ "$param" == "-limit-noise-symbols-number" ]
+    then # Limit the number of noise symbols by 2*xxx
+      cxxflags+=" -DFLOAT_LIMIT_NOISE_SYMBOLS_NUMBER="
+      has_include=1
+    elif [ "$param" == "-keep-double" ]
+    then
+      cxxflags+=" -DFLOAT_KEEP_DOUBLE"
+    elif [ "$param" == "-threshold-detection" ]
+    then
+      cxxflags+=" -DFLOAT_THRESHOLD_DETECTION"
+    elif [ "$param" == "-loop" ]
+    then
+      cxxflags+=" -DFLOAT_LOOP_UNSTABLE"
+      loop_unstable=1
+    elif [ "$param" == "-verbose" ]
+    then
+      verbose=1
+    elif [ "$param" == "-print-path" ]
+    then
+      cxxflags+=" -DFLOAT_PRINT_PATH"
+    elif [ "$param" == "-scenario" ]
+    then
+      cxxflags+=" -DFLOAT_SCENARIO"
+    elif [ "$param" == "-interface" ]
+    then
+      interface=1
+    elif [ "$param" == "-backtrace" ]
+    then
+      cxxflags+=" -DFLOAT_BACKTRACE"
+    else
+      ((opt_params_count--))
+      break
+    fi
+  else
+    break
+  fi
+done
+
+cxxflags+=" -include ${FLOATDIAGNOSIS_TESTS_INCLUDE}/std_header.h"
+
+if [ ${analysis} -eq 0 ]
+then
+  cxxflags+=" -DFLOAT_EXACT"
+elif [ ${analysis} -eq 1 ]
+then
+  cxxflags+=" -DFLOAT_AFFINE"
+elif [ ${analysis} -eq 2 ]
+then
+  cxxflags+=" -DFLOAT_INTERVAL"
+else
+  cxxflags+=" -DFLOAT_AFFINE"
+fi
+
+if [ ${loop_unstable} = 0 ]
+then
+  cxxflags+=" -DFLOAT_FIRST_FOLLOW_EXE"
+fi
+if [ ${optim} = 1 ]
+then
+  if [ 0 -ne 0 ]
+  then
+    cxxflags+=" -O3 -DDefineDebugLevel=1 -x c++ -Wall \
+             -Wno-unused-local-typedefs -Wno-unused-variable -Woverloaded-virtual -fmessage-length=0"
+  elif [ 1 -ne 0 ]
+  then
+    cxxflags+=" -O3 -DDefineDebugLevel=1 -Wall -Wno-unused-but-set-variable \
+             -Wno-unused-local-typedefs -Wno-unused-variable -Woverloaded-virtual -fmessage-length=0"
+  else
+    cxxflags+=" -O3 -DDefineDebugLevel=1"
+  fi
+else
+  cxxflags+=" -g -O0 -D_GLIBCXX_USE_CXX11_ABI=0"
+fi
+if [ ${verbose} = 0 ]
+then
+  cxxflags+=" -DFLOAT_SILENT_COMPUTATIONS"
+fi
+
+if [ ${interface} = 1 ]
+then
+  cxxflags+=" -DFLOAT_INTERFACE"
+  ldflags="-L${FLOATDIAGNOSIS_LIB} -Wl,-rpath,${FLOATDIAGNOSIS_LIB} -lm -lFloatDiagnosisInterface"
+else
+  ldflags="-L${FLOATDIAGNOSIS_LIB} -Wl,-rpath,${FLOATDIAGNOSIS_LIB} -lm -lFloatDiagnosis"
+fi
+
+ldflags+="  -rdynamic"
+
+shift ${opt_params_count}
+
+if [ ${opt_params_count} -eq 0 ]
+then
+  echo "usage: comp_float_diagnosis.sh -affine myprogram.cpp -o myprogram"
+  echo -e "\t-include headerfile.h\tto include headerfile.h before the instrumentation of float/double types"
+  echo -e "\t-progname \"basename\"\tto specify the output file"
+  echo -e "\t-threshold-detection\temit a warning when the relative error goes beyond a value specified in progname_diag_..._in"
+  echo -e "\t-keep-double\t\tdo not replace float/double, but use float_fld/double_fld to define the instrumented types"
+  echo -e "\t-exact\t\t\tto perform an exact arithmetic based analysis"
+  echo -e "\t-affine\t\t\tto perform an affine arithmetic based analysis"
+  echo -e "\t-scenario\t\tin affine mode, to choose a thin input scenario instead of the whole input intervals"
+  echo -e "\t-interval\t\tto perform an interval based analysis"
+  echo -e "\t-interface\t\tuse an interface for the library headers, which improves the compilation time"
+  echo -e "\t-optim\t\t\tto compile with the optimization flags"
+  echo -e "\t-atomic\t\t\tto forget the errors on the constant values"
+  echo -e "\t-loop\t\t\tloop over all possible execution paths"
+  echo -e "\t-print-path\t\tin the loop mode, show the current path which gives an estimate of the analysis time"
+  echo -e "\t-verbose\t\tlog all computations in the output file progname_diag_..._out"
+  echo -e "\t-pure-zonotope\t\tin affine mode, keep maximal relationships among variables to the detriment of constraints"
+  echo -e "\t-track\t\t\tin affine mode, keep the origin of noise symbols as expressions"
+  echo -e "\t-create-interval-trigger-percent x.xx\tin affine mode, replace the zonotope by the interval if the interval is x.xx% better than the zonotope"
+  echo -e "\t-limit-noise-symbols-number xxx\t\tin affine mode, for each variable, limit the number of noise symbols by 2*xxx"
+  echo -e "\t-map-symbols\t\tin affine mode, generates a map for the noise symbols in \"prog-name_map\""
+  echo -e "\t-backtrace\t\twrite a backtrace at every warning"
+  exit 1
+fi
+
+if [ ${has_progname} -eq 0 ]
+then
+  basefile=${1##*/}
+  basefile=${basefile%.c} 
+  if [ "${basefile}" == "" ]
+  then
+    basefile=progname
+  elif [ "${basefile:0:1}" == "-" ]
+  then
+    basefile=progname
+  fi
+fi
+
+for param in "$@"
+do
+  if [ "${param}" == "-c" ]
+  then
+    ldflags=""
+  fi
+done
+
+if [ ${has_progname} -eq 0 ]
+then
+  echo g++ -DPROG_NAME="$basefile" ${cxxflags} $* ${ldflags}
+  g++ -DPROG_NAME="$basefile" ${cxxflags} $* ${ldflags}
+else
+  echo g++ ${cxxflags} $* ${ldflags}
+  g++ ${cxxflags} $* ${ldflags}
+fi
@@ -0,0 +1,54 @@
+#if 0
+#define FLOAT_ALLOW_READ_EXCEPTION                                  1
+#endif
+
+#if 1
+#define FLOAT_GENERIC_BASE_LONG                                     1
+#endif
+
+#if 0
+#define FLOAT_GENERIC_BASE_UNSIGNED                                 1
+#endif
+
+#if 1
+#define FLOAT_LONG_WRITE                                            1
+#endif
+
+#if 0
+#define FLOAT_REAL_BITS_NUMBER                                      
+#endif
+
+#if 0
+#define FLOAT_ZONOTOPE_ALLOW_SIMPLEX                                1
+#endif
+
+#if 0
+#define FLOAT_ZONOTOPE_DOES_ABSORB_HIGH_LEVEL                       1
+#endif
+
+#if 0
+#define FLOAT_ZONOTOPE_DOES_EXCLUDE_CONSTANT_FROM_SYMBOL_ABSORPTION 1
+#endif
+
+#if 0
+#define FLOAT_ZONOTOPE_LIMIT_SYMBOL_ABSORPTION                      
+#endif
+
+#if 0
+#define FLOAT_ZONOTOPE_FLAT_EQUATION                                1
+#endif
+
+#if 0
+#define FLOAT_ALLOCATION_POOL                                       1
+#endif
+
+#if 1
+#define FLOAT_LAZY_IMPLEMENTATION                                   1
+#endif
+
+#if 1
+#define FLOAT_MULTI_DOUBLE_REAL                                     1
+#endif
+
+#define FLOAT_INIT_MESSAGE                                          TOSTRING(FLDLib 0.9.0) " software --- CEA LIST --- LSL Laboratory"
+
@@ -448,6 +448,9 @@ class Access : public DInteger::Access {
    };
 #endif // StandardClassesHPP
 
+   // first byte of a floating point value in the raw format
+   enum { URawTag = 0x01 };
+
    class Carry {
      private:
       bool fCarry;
@@ -52,12 +52,17 @@ namespace DInteger {
 
 class Access {
   public:
+#ifdef __GNUC__
+   static int log_base_2(unsigned int value)
+      {  return (value == 0U) ? 1 : (int) (8*sizeof(unsigned int)) - __builtin_clz(value); }
+#else
    static int log_base_2(unsigned int value)
       {  int result = 1;
          while ((value >>= 1) != 0)
             ++result;
          return result;
       }
+#endif
 };
 
 } // end of namespace DInteger
@@ -93,6 +98,32 @@ class UnsignedBaseStoreTraits {
       {  return (result < operand) ? 1U : 0U; }
    static unsigned int detectCarryBeforeSubstraction(unsigned int first, unsigned int second)
       {  return (first < second) ? 1U : 0U; }
+   static unsigned int addWithCarry(unsigned int& cell, unsigned int value, unsigned int carry)
+      {  cell += value;
+         unsigned int result = detectCarryAfterAddition(cell, value);
+         cell += carry;
+         return result + detectCarryAfterAddition(cell, carry);
+      }
+   static unsigned int subWithCarry(unsigned int& cell, unsigned int value, unsigned int carry)
+      {  unsigned int result = detectCarryBeforeSubstraction(cell, value);
+         cell -= value;
+         result += detectCarryBeforeSubstraction(cell, carry);
+         cell -= carry;
+         return result;
+      }
+   static unsigned int multAndAdd(unsigned int first, unsigned int second, unsigned int add,
+         unsigned int& carry)
+      {  unsigned long long int result = (unsigned long long int) first*second + add + carry;
+         carry = (unsigned int) (result >> 8*sizeof(unsigned int));
+         return (unsigned int) result;
+      }
+   static unsigned int divideWide(unsigned int high, unsigned int low, unsigned int divide,
+         unsigned int& remainder)
+      {  AssumeCondition(high < divide)
+         unsigned long long int numerator = ((unsigned long long int) high << 8*sizeof(unsigned int)) | low;
+         remainder = (unsigned int) (numerator % divide);
+         return (unsigned int) (numerator / divide);
+      }
    static unsigned int getStoreMidHighPart(unsigned int value, unsigned int store)
       {  return ((value << (4*sizeof(unsigned int))) | (store & ~(~0U << 4*sizeof(unsigned int)))); }
    static void storeIntoMidHighPart(unsigned int value, unsigned int& store)
@@ -43,12 +43,17 @@ class UnsignedLongBaseStoreTraits {
    typedef unsigned long* BaseTypePointer;
    typedef unsigned long& BaseTypeReference;
    typedef unsigned long BaseTypeConstReference;
+#ifdef __GNUC__
+   static int log_base_2(unsigned long value)
+      {  return (value == 0UL) ? 1 : (int) (8*sizeof(unsigned long)) - __builtin_clzl(value); }
+#else
    static int log_base_2(unsigned long value)
       {  int result = 1;
          while ((value >>= 1) != 0)
             ++result;
          return result;
       }
+#endif
    static void clearArray(unsigned long* array, int count)
       {  memset(array, 0, count*sizeof(unsigned long)); }
    static void copyArray(unsigned long* target, const unsigned long* source, int count)
@@ -68,6 +73,70 @@ class UnsignedLongBaseStoreTraits {
       {  return (result < operand) ? 1UL : 0UL; }
    static unsigned long detectCarryBeforeSubstraction(unsigned long first, unsigned long second)
       {  return (first < second) ? 1UL : 0UL; }
+   static unsigned long addWithCarry(unsigned long& cell, unsigned long value, unsigned long carry)
+      {  cell += value;
+         unsigned long result = detectCarryAfterAddition(cell, value);
+         cell += carry;
+         return result + detectCarryAfterAddition(cell, carry);
+      }
+   static unsigned long subWithCarry(unsigned long& cell, unsigned long value, unsigned long carry)
+      {  unsigned long result = detectCarryBeforeSubstraction(cell, value);
+         cell -= value;
+         result += detectCarryBeforeSubstraction(cell, carry);
+         cell -= carry;
+         return result;
+      }
+#ifdef __SIZEOF_INT128__
+   static unsigned long multAndAdd(unsigned long first, unsigned long second, unsigned long add,
+         unsigned long& carry)
+      {  unsigned __int128 result = (unsigned __int128) first*second + add + carry;
+         carry = (unsigned long) (result >> 8*sizeof(unsigned long));
+         return (unsigned long) result;
+      }
+   static unsigned long divideWide(unsigned long high, unsigned long low, unsigned long divide,
+         unsigned long& remainder)
+      {  AssumeCondition(high < divide)
+#if defined(__GNUC__) && defined(__x86_64__)
+         unsigned long result;
+         __asm__("divq %4" : "=a"(result), "=d"(remainder) : "a"(low), "d"(high), "rm"(divide));
+         return result;
+#else
+         unsigned __int128 numerator = ((unsigned __int128) high << 8*sizeof(unsigned long)) | low;
+         remainder = (unsigned long) (numerator % divide);
+         return (unsigned long) (numerator / divide);
+#endif
+      }
+#else
+   static unsigned long multAndAdd(unsigned long first, unsigned long second, unsigned long add,
+         unsigned long& carry)
+      {  unsigned long firstLow = getMidLowPart(first), firstHigh = getMidHighPart(first),
+            secondLow = getMidLowPart(second), secondHigh = getMidHighPart(second);
+         unsigned long lowProduct = firstLow*secondLow, highProduct = firstHigh*secondHigh;
+         unsigned long midFirst = firstLow*secondHigh, midSecond = firstHigh*secondLow;
+         unsigned long result = lowProduct + (midFirst << 4*sizeof(unsigned long));
+         highProduct += detectCarryAfterAddition(result, lowProduct);
+         unsigned long temp = result;
+         result += (midSecond << 4*sizeof(unsigned long));
+         highProduct += detectCarryAfterAddition(result, temp);
+         highProduct += getMidHighPart(midFirst) + getMidHighPart(midSecond);
+         result += add;
+         highProduct += detectCarryAfterAddition(result, add);
+         result += carry;
+         highProduct += detectCarryAfterAddition(result, carry);
+         carry = highProduct;
+         return result;
+      }
+   static unsigned long divideWide(unsigned long high, unsigned long low, unsigned long divide,
+         unsigned long& remainder)
+      {  AssumeCondition((high < divide) && (getMidHighPart(divide) == 0))
+         unsigned long numerator = (high << 4*sizeof(unsigned long)) | getMidHighPart(low);
+         unsigned long result = (numerator / divide) << 4*sizeof(unsigned long);
+         numerator = ((numerator % divide) << 4*sizeof(unsigned long)) | getMidLowPart(low);
+         result |= numerator / divide;
+         remainder = numerator % divide;
+         return result;
+      }
+#endif
    static unsigned long getStoreMidHighPart(unsigned long value, unsigned long store)
       {  return ((value << (4*sizeof(unsigned long))) | (store & ~(~0UL << 4*sizeof(unsigned long)))); }
    static void storeIntoMidHighPart(unsigned long value, unsigned long& store)
@@ -550,6 +619,272 @@ class TGBigCellInt<BaseStoreTraits, DInteger::TGCellIntegerTraits<BaseStoreTrait
    void clear() { value() = 0x0; }
 };
 
+
+/* Loop-free versions of the cell operations for the mantissas of the default reals: */
+/*   FLOAT_REAL_BITS_NUMBER=123 needs 2 cells of 64 bits or 4 cells of 32 bits.       */
+
+template <class BaseStoreTraits>
+class TGBigCellInt<BaseStoreTraits, DInteger::TGCellIntegerTraits<BaseStoreTraits, 2> >
+   :  public DInteger::TGBigCellInt<BaseStoreTraits, DInteger::TGCellIntegerTraits<BaseStoreTraits, 2> > {
+  public:
+   typedef typename BaseStoreTraits::BaseType BaseType;
+   typedef typename BaseStoreTraits::BaseTypeConstReference BaseTypeConstReference;
+
+  private:
+   typedef TGBigCellInt<BaseStoreTraits, DInteger::TGCellIntegerTraits<BaseStoreTraits, 2> > thisType;
+   typedef DInteger::TGBigCellInt<BaseStoreTraits, DInteger::TGCellIntegerTraits<BaseStoreTraits, 2> > inherited;
+   static const int USizeBaseInBits = BaseStoreTraits::USizeBaseInBits;
+
+  public:
+   TGBigCellInt() : inherited() {}
+   TGBigCellInt(BaseTypeConstReference value) : inherited(value) {}
+   TGBigCellInt(const thisType& source) = default;
+   thisType& operator=(const thisType& source) = default;
+   thisType& operator=(BaseTypeConstReference value)
+      {  return (thisType&) inherited::operator=(value); }
+
+   ComparisonResult compare(const inherited& source) const
+      {  return (inherited::carray(1) < source.carray(1)) ? CRLess
+            : ((inherited::carray(1) > source.carray(1)) ? CRGreater
+            : ((inherited::carray(0) < source.carray(0)) ? CRLess
+            : ((inherited::carray(0) > source.carray(0)) ? CRGreater : CREqual)));
+      }
+   bool operator<(const inherited& source) const
+      {  return (inherited::carray(1) < source.carray(1))
+            || ((inherited::carray(1) == source.carray(1)) && (inherited::carray(0) < source.carray(0)));
+      }
+   bool operator>(const inherited& source) const
+      {  return (inherited::carray(1) > source.carray(1))
+            || ((inherited::carray(1) == source.carray(1)) && (inherited::carray(0) > source.carray(0)));
+      }
+   bool operator<=(const inherited& source) const { return !operator>(source); }
+   bool operator>=(const inherited& source) const { return !operator<(source); }
+   bool operator==(const inherited& source) const
+      {  return (inherited::carray(0) == source.carray(0)) && (inherited::carray(1) == source.carray(1)); }
+   bool operator!=(const inherited& source) const { return !operator==(source); }
+
+   thisType& operator<<=(int shift)
+      {  AssumeCondition(shift >= 0)
+         if (shift >= USizeBaseInBits) {
+            inherited::array(1) = (shift < 2*USizeBaseInBits)
+               ? (BaseType) (inherited::carray(0) << (shift - USizeBaseInBits)) : (BaseType) 0x0;
+            inherited::array(0) = 0x0;
+         }
+         else if (shift > 0) {
+            inherited::array(1) = (inherited::carray(1) << shift)
+               | (inherited::carray(0) >> (USizeBaseInBits - shift));
+            inherited::array(0) <<= shift;
+         };
+         return *this;
+      }
+   thisType& operator>>=(int shift)
+      {  AssumeCondition(shift >= 0)
+         if (shift >= USizeBaseInBits) {
+            inherited::array(0) = (shift < 2*USizeBaseInBits)
+               ? (BaseType) (inherited::carray(1) >> (shift - USizeBaseInBits)) : (BaseType) 0x0;
+            inherited::array(1) = 0x0;
+         }
+         else if (shift > 0) {
+            inherited::array(0) = (inherited::carray(0) >> shift)
+               | (inherited::carray(1) << (USizeBaseInBits - shift));
+            inherited::array(1) >>= shift;
+         };
+         return *this;
+      }
+
+   bool isZero() const
+      {  return BaseStoreTraits::isZeroValue(inherited::carray(0))
+            && BaseStoreTraits::isZeroValue(inherited::carray(1));
+      }
+   bool hasZero(int shift) const
+      {  return (shift <= USizeBaseInBits)
+            ? BaseStoreTraits::hasZeroValue(inherited::carray(0), shift)
+            : (BaseStoreTraits::isZeroValue(inherited::carray(0))
+               && ((shift >= 2*USizeBaseInBits)
+                  ? BaseStoreTraits::isZeroValue(inherited::carray(1))
+                  : BaseStoreTraits::hasZeroValue(inherited::carray(1), shift - USizeBaseInBits)));
+      }
+   int log_base_2() const
+      {  return BaseStoreTraits::isZeroValue(inherited::carray(1))
+            ? BaseStoreTraits::log_base_2(inherited::carray(0))
+            : (BaseStoreTraits::log_base_2(inherited::carray(1)) + USizeBaseInBits);
+      }
+
+   typedef typename inherited::Carry Carry;
+   Carry add(const inherited& source)
+      {  BaseType carry = BaseStoreTraits::addWithCarry(inherited::array(0), source.carray(0), 0x0);
+         return Carry(BaseStoreTraits::addWithCarry(inherited::array(1), source.carray(1), carry));
+      }
+   Carry sub(const inherited& source)
+      {  BaseType carry = BaseStoreTraits::subWithCarry(inherited::array(0), source.carray(0), 0x0);
+         return Carry(BaseStoreTraits::subWithCarry(inherited::array(1), source.carray(1), carry));
+      }
+   Carry plusAssign(const inherited& source) { return add(source); }
+   Carry minusAssign(const inherited& source) { return sub(source); }
+   Carry inc()
+      {  BaseType carry = BaseStoreTraits::addWithCarry(inherited::array(0), 0x0, 0x1);
+         return Carry(BaseStoreTraits::addWithCarry(inherited::array(1), 0x0, carry));
+      }
+   Carry dec()
+      {  BaseType carry = BaseStoreTraits::subWithCarry(inherited::array(0), 0x0, 0x1);
+         return Carry(BaseStoreTraits::subWithCarry(inherited::array(1), 0x0, carry));
+      }
+
+   thisType& operator+=(const inherited& source) { add(source); return *this; }
+   thisType operator+(const inherited& source) const
+      {  thisType result = *this; result += source; return result; }
+   thisType& operator-=(const inherited& source) { sub(source); return *this; }
+   thisType operator-(const inherited& source) const
+      {  thisType result = *this; result -= source; return result; }
+   thisType& operator--() { dec(); return *this; }
+   thisType& operator++() { inc(); return *this; }
+
+   Carry multAssign(BaseTypeConstReference source)
+      {  BaseType carry = 0x0;
+         inherited::array(0) = BaseStoreTraits::multAndAdd(inherited::carray(0), source, 0x0, carry);
+         inherited::array(1) = BaseStoreTraits::multAndAdd(inherited::carray(1), source, 0x0, carry);
+         return Carry(carry);
+      }
+   typedef typename inherited::MultResult MultResult;
+   void mult(const inherited& source, MultResult& result) const
+      {  BaseType carry = 0x0;
+         result[0] = BaseStoreTraits::multAndAdd(inherited::carray(0), source.carray(0), result[0], carry);
+         result[1] = BaseStoreTraits::multAndAdd(inherited::carray(1), source.carray(0), result[1], carry);
+         result[2] = carry;
+         carry = 0x0;
+         result[1] = BaseStoreTraits::multAndAdd(inherited::carray(0), source.carray(1), result[1], carry);
+         result[2] = BaseStoreTraits::multAndAdd(inherited::carray(1), source.carray(1), result[2], carry);
+         result[3] = carry;
+      }
+   thisType& operator*=(const inherited& source)
+      {  MultResult result;
+         mult(source, result);
+         inherited::copyLow(result);
+         return *this;
+      }
+   thisType& operator*=(BaseTypeConstReference source)
+      {  Carry carry = multAssign(source); AssumeCondition(!carry.hasCarry()) return *this; }
+};
+
+template <class BaseStoreTraits>
+class TGBigCellInt<BaseStoreTraits, DInteger::TGCellIntegerTraits<BaseStoreTraits, 4> >
+   :  public DInteger::TGBigCellInt<BaseStoreTraits, DInteger::TGCellIntegerTraits<BaseStoreTraits, 4> > {
+  public:
+   typedef typename BaseStoreTraits::BaseType BaseType;
+   typedef typename BaseStoreTraits::BaseTypeConstReference BaseTypeConstReference;
+
+  private:
+   typedef TGBigCellInt<BaseStoreTraits, DInteger::TGCellIntegerTraits<BaseStoreTraits, 4> > thisType;
+   typedef DInteger::TGBigCellInt<BaseStoreTraits, DInteger::TGCellIntegerTraits<BaseStoreTraits, 4> > inherited;
+
+   void multAddRow(BaseTypeConstReference source, BaseType* result) const
+      {  BaseType carry = 0x0;
+         result[0] = BaseStoreTraits::multAndAdd(inherited::carray(0), source, result[0], carry);
+         result[1] = BaseStoreTraits::multAndAdd(inherited::carray(1), source, result[1], carry);
+         result[2] = BaseStoreTraits::multAndAdd(inherited::carray(2), source, result[2], carry);
+         result[3] = BaseStoreTraits::multAndAdd(inherited::carray(3), source, result[3], carry);
+         result[4] = carry;
+      }
+
+  public:
+   TGBigCellInt() : inherited() {}
+   TGBigCellInt(BaseTypeConstReference value) : inherited(value) {}
+   TGBigCellInt(const thisType& source) = default;
+   thisType& operator=(const thisType& source) = default;
+   thisType& operator=(BaseTypeConstReference value)
+      {  return (thisType&) inherited::operator=(value); }
+
+   ComparisonResult compare(const inherited& source) const
+      {  return (inherited::carray(3) != source.carray(3))
+               ? ((inherited::carray(3) < source.carray(3)) ? CRLess : CRGreater)
+            : ((inherited::carray(2) != source.carray(2))
+               ? ((inherited::carray(2) < source.carray(2)) ? CRLess : CRGreater)
+            : ((inherited::carray(1) != source.carray(1))
+               ? ((inherited::carray(1) < source.carray(1)) ? CRLess : CRGreater)
+            : ((inherited::carray(0) != source.carray(0))
+               ? ((inherited::carray(0) < source.carray(0)) ? CRLess : CRGreater) : CREqual)));
+      }
+   bool operator<(const inherited& source) const { return compare(source) == CRLess; }
+   bool operator>(const inherited& source) const { return compare(source) == CRGreater; }
+   bool operator<=(const inherited& source) const { return compare(source) <= CREqual; }
+   bool operator>=(const inherited& source) const { return compare(source) >= CREqual; }
+   bool operator==(const inherited& source) const
+      {  return (inherited::carray(0) == source.carray(0)) && (inherited::carray(1) == source.carray(1))
+            && (inherited::carray(2) == source.carray(2)) && (inherited::carray(3) == source.carray(3));
+      }
+   bool operator!=(const inherited& source) const { return !operator==(source); }
+
+   bool isZero() const
+      {  return BaseStoreTraits::isZeroValue(inherited::carray(0) | inherited::carray(1)
+               | inherited::carray(2) | inherited::carray(3));
+      }
+
+   typedef typename inherited::Carry Carry;
+   Carry add(const inherited& source)
+      {  BaseType carry = BaseStoreTraits::addWithCarry(inherited::array(0), source.carray(0), 0x0);
+         carry = BaseStoreTraits::addWithCarry(inherited::array(1), source.carray(1), carry);
+         carry = BaseStoreTraits::addWithCarry(inherited::array(2), source.carray(2), carry);
+         return Carry(BaseStoreTraits::addWithCarry(inherited::array(3), source.carray(3), carry));
+      }
+   Carry sub(const inherited& source)
+      {  BaseType carry = BaseStoreTraits::subWithCarry(inherited::array(0), source.carray(0), 0x0);
+         carry = BaseStoreTraits::subWithCarry(inherited::array(1), source.carray(1), carry);
+         carry = BaseStoreTraits::subWithCarry(inherited::array(2), source.carray(2), carry);
+         return Carry(BaseStoreTraits::subWithCarry(inherited::array(3), source.carray(3), carry));
+      }
+   Carry plusAssign(const inherited& source) { return add(source); }
+   Carry minusAssign(const inherited& source) { return sub(source); }
+   Carry inc()
+      {  BaseType carry = BaseStoreTraits::addWithCarry(inherited::array(0), 0x0, 0x1);
+         carry = BaseStoreTraits::addWithCarry(inherited::array(1), 0x0, carry);
+         carry = BaseStoreTraits::addWithCarry(inherited::array(2), 0x0, carry);
+         return Carry(BaseStoreTraits::addWithCarry(inherited::array(3), 0x0, carry));
+      }
+   Carry dec()
+      {  BaseType carry = BaseStoreTraits::subWithCarry(inherited::array(0), 0x0, 0x1);
+         carry = BaseStoreTraits::subWithCarry(inherited::array(1), 0x0, carry);
+         carry = BaseStoreTraits::subWithCarry(inherited::array(2), 0x0, carry);
+         return Carry(BaseStoreTraits::subWithCarry(inherited::array(3), 0x0, carry));
+      }
+
+   thisType& operator+=(const inherited& source) { add(source); return *this; }
+   thisType operator+(const inherited& source) const
+      {  thisType result = *this; result += source; return result; }
+   thisType& operator-=(const inherited& source) { sub(source); return *this; }
+   thisType operator-(const inherited& source) const
+      {  thisType result = *this; result -= source; return result; }
+   thisType& operator--() { dec(); return *this; }
+   thisType& operator++() { inc(); return *this; }
+
+   Carry multAssign(BaseTypeConstReference source)
+      {  BaseType carry = 0x0;
+         inherited::array(0) = BaseStoreTraits::multAndAdd(inherited::carray(0), source, 0x0, carry);
+         inherited::array(1) = BaseStoreTraits::multAndAdd(inherited::carray(1), source, 0x0, carry);
+         inherited::array(2) = BaseStoreTraits::multAndAdd(inherited::carray(2), source, 0x0, carry);
+         inherited::array(3) = BaseStoreTraits::multAndAdd(inherited::carray(3), source, 0x0, carry);
+         return Carry(carry);
+      }
+   typedef typename inherited::MultResult MultResult;
+   void mult(const inherited& source, MultResult& result) const
+      {  BaseType cells[8] = { result[0], result[1], result[2], result[3],
+               result[4], result[5], result[6], result[7] };
+         multAddRow(source.carray(0), cells);
+         multAddRow(source.carray(1), cells+1);
+         multAddRow(source.carray(2), cells+2);
+         multAddRow(source.carray(3), cells+3);
+         result[0] = cells[0]; result[1] = cells[1]; result[2] = cells[2]; result[3] = cells[3];
+         result[4] = cells[4]; result[5] = cells[5]; result[6] = cells[6]; result[7] = cells[7];
+      }
+   thisType& operator*=(const inherited& source)
+      {  MultResult result;
+         mult(source, result);
+         inherited::copyLow(result);
+         return *this;
+      }
+   thisType& operator*=(BaseTypeConstReference source)
+      {  Carry carry = multAssign(source); AssumeCondition(!carry.hasCarry()) return *this; }
+};
+
 namespace DInteger {
 
 template<int i>
@@ -33,6 +33,9 @@
 #define NumericalDomains_FloatExactBaseH
 
 #include "NumericalLattices/FloatExactBaseTypes.h"
+#ifdef FLOAT_MULTI_DOUBLE_REAL
+#include "NumericalLattices/FloatExactMultiDouble.h"
+#endif
 
 namespace NumericalDomains {
 
@@ -37,6 +37,9 @@
 #include "Collection/ConcreteCollection/List.h"
 #include "Collection/ConcreteCollection/Array.h"
 #include "Collection/ConcreteCollection/SortedArray.h"
+#ifdef FLOAT_ALLOCATION_POOL
+#include "Pointer/PoolAllocator.h"
+#endif
 
 namespace NumericalDomains { namespace DAffine {
 
@@ -99,6 +102,14 @@ class Symbol : public SymbolRegistration, public PNT::SharedCollection::Element,
    DCompare(Symbol)
    StaticInheritConversions(Symbol, inherited)
 
+#ifdef FLOAT_ALLOCATION_POOL
+#include "StandardClasses/UndefineNew.h"
+   static void* operator new(size_t size) { return PNT::SizeClassPool::global().allocate(size); }
+   static void operator delete(void* pointer, size_t size)
+      {  PNT::SizeClassPool::global().deallocate(pointer, size); }
+#include "StandardClasses/DefineNew.h"
+#endif
+
    bool hasOrder() const { return uOrder > 0; }
    void setOrder(int order) { uOrder = order; }
    int getOrder() const { return uOrder; }
@@ -345,10 +356,70 @@ class VirtualSymbolDefinitionTracker : public EnhancedObject {
 class SymbolsManager : public EnhancedObject {
   private:
    typedef EnhancedObject inherited;
+
+   // Dense table indexed by the symbol order. The entry order-1 refers to the last
+   //   registered symbol with this order or it is a tombstone (nullptr) after a free.
+   //   The lists keep the ownership of the symbols; the table only replaces the
+   //   backward scans of the lists in the find* methods.
+   class OrderTable {
+     private:
+      COL::TVector<Symbol*, COL::DVector::TSystemElementTraits<Symbol*> > vpsSymbols;
+
+     public:
+      OrderTable() {}
+      OrderTable(const OrderTable&) {}
+      OrderTable& operator=(const OrderTable&) = delete;
+
+      void swap(OrderTable& source) { vpsSymbols.swap(source.vpsSymbols); }
+      void clear() { vpsSymbols.removeAll(); }
+      void add(Symbol& symbol)
+         {  int index = symbol.getOrder()-1;
+            AssumeCondition(index >= 0)
+            if (index >= vpsSymbols.count()) {
+               vpsSymbols.bookPlace(index+1-vpsSymbols.count());
+               while (vpsSymbols.count() < index)
+                  vpsSymbols.insertAtEnd(nullptr);
+               vpsSymbols.insertAtEnd(&symbol);
+            }
+            else
+               vpsSymbols.referenceAt(index) = &symbol;
+         }
+      void remove(const Symbol& symbol)
+         {  int index = symbol.getOrder()-1;
+            if (index >= 0 && index < vpsSymbols.count() && vpsSymbols[index] == &symbol) {
+               vpsSymbols.referenceAt(index) = nullptr;
+               while (vpsSymbols.count() > 0 && !vpsSymbols.last())
+                  vpsSymbols.removeAtEnd();
+            };
+         }
+      void removeAfter(int order)
+         {  if (order < 0)
+               order = 0;
+            if (order < vpsSymbols.count())
+               vpsSymbols.removeAllBetween(order, -1);
+            while (vpsSymbols.count() > 0 && !vpsSymbols.last())
+               vpsSymbols.removeAtEnd();
+         }
+      Symbol* locate(int order) const
+         {  return (order > 0 && order <= vpsSymbols.count()) ? vpsSymbols[order-1] : nullptr; }
+      Symbol* locateLastBefore(int order) const
+         {  if (order > vpsSymbols.count())
+               order = vpsSymbols.count();
+            for (; order > 0; --order)
+               if (vpsSymbols[order-1])
+                  return vpsSymbols[order-1];
+            return nullptr;
+         }
+   };
+
    COL::TCopyCollection<COL::TList<Symbol, Symbol::Registration> > lsCentralSymbols;
    COL::TCopyCollection<COL::TList<Symbol, Symbol::Registration> > lsNoiseSymbols;
    COL::TCopyCollection<COL::TList<Symbol, Symbol::Registration> > lsDefinedSymbols;
    COL::TCopyCollection<COL::TList<Symbol, Symbol::Registration> > lsHighLevelSymbols;
+   OrderTable otCentralSymbols;
+   OrderTable otNoiseSymbols;
+   OrderTable otDefinedSymbols;
+   OrderTable otHighLevelSymbols;
    int uHighLevelSymbolsCounter;
 
   public:
@@ -363,6 +434,10 @@ class SymbolsManager : public EnhancedObject {
          lsNoiseSymbols.swap(source.lsNoiseSymbols);
          lsDefinedSymbols.swap(source.lsDefinedSymbols);
          lsHighLevelSymbols.swap(source.lsHighLevelSymbols);
+         otCentralSymbols.swap(source.otCentralSymbols);
+         otNoiseSymbols.swap(source.otNoiseSymbols);
+         otDefinedSymbols.swap(source.otDefinedSymbols);
+         otHighLevelSymbols.swap(source.otHighLevelSymbols);
          int temp = uHighLevelSymbolsCounter;
          uHighLevelSymbolsCounter = source.uHighLevelSymbolsCounter;
          source.uHighLevelSymbolsCounter = temp;
@@ -372,6 +447,10 @@ class SymbolsManager : public EnhancedObject {
          lsNoiseSymbols.freeAll();
          lsDefinedSymbols.freeAll();
          lsHighLevelSymbols.freeAll();
+         otCentralSymbols.clear();
+         otNoiseSymbols.clear();
+         otDefinedSymbols.clear();
+         otHighLevelSymbols.clear();
          uHighLevelSymbolsCounter = 0;
       }
    bool contains(const Symbol& symbol) const
@@ -479,18 +558,21 @@ class SymbolsManager : public EnhancedObject {
       {  Symbol* result = new CentralSymbol();
          lsCentralSymbols.insertNewAtEnd(result);
          result->setOrder(lsCentralSymbols.count());
+         otCentralSymbols.add(*result);
          return result;
       }
    virtual Symbol* createNoiseSymbol()
       {  Symbol* result = new NoiseSymbol();
          lsNoiseSymbols.insertNewAtEnd(result);
          result->setOrder(lsNoiseSymbols.count());
+         otNoiseSymbols.add(*result);
          return result;
       }
    virtual Symbol* createHighLevelSymbol()
       {  Symbol* result = new HighLevelSymbol();
          lsHighLevelSymbols.insertNewAtEnd(result);
          result->setOrder(++uHighLevelSymbolsCounter);
+         otHighLevelSymbols.add(*result);
          return result;
       }
    void freeHighLevelSymbol(HighLevelSymbol* symbol) // [TODO] verify the manager for LinearInvariantSynthesis!!!
@@ -499,6 +581,7 @@ class SymbolsManager : public EnhancedObject {
          AssumeCondition(!lsHighLevelSymbols.foreachDo([symbol](const Symbol& iterate)
             {  return &iterate != symbol; }))
 #endif
+         otHighLevelSymbols.remove(*symbol);
          COL::TList<Symbol, Symbol::Registration>::Cursor cursor(lsHighLevelSymbols);
          cursor.gotoReference(*symbol);
          lsHighLevelSymbols.freeAt(cursor);
@@ -511,6 +594,7 @@ class SymbolsManager : public EnhancedObject {
                   AssumeCondition(!lsCentralSymbols.foreachDo([symbol](const Symbol& iterate)
                      {  return &iterate != symbol; }))
 #endif
+                  otCentralSymbols.remove(*symbol);
                   COL::TList<Symbol, Symbol::Registration>::Cursor cursor(lsCentralSymbols);
                   cursor.gotoReference(*symbol);
                   lsCentralSymbols.freeAt(cursor);
@@ -523,6 +607,7 @@ class SymbolsManager : public EnhancedObject {
                   AssumeCondition(!lsNoiseSymbols.foreachDo([symbol](const Symbol& iterate)
                      {  return &iterate != symbol; }))
 #endif
+                  otNoiseSymbols.remove(*symbol);
                   COL::TList<Symbol, Symbol::Registration>::Cursor cursor(lsNoiseSymbols);
                   cursor.gotoReference(*symbol);
                   lsNoiseSymbols.freeAt(cursor);
@@ -536,6 +621,7 @@ class SymbolsManager : public EnhancedObject {
                   AssumeCondition(!lsDefinedSymbols.foreachDo([symbol](const Symbol& iterate)
                      {  return &iterate != symbol; }))
 #endif
+                  otDefinedSymbols.remove(*symbol);
                   COL::TList<Symbol, Symbol::Registration>::Cursor cursor(lsDefinedSymbols);
                   cursor.gotoReference(*symbol);
                   lsDefinedSymbols.freeAt(cursor);
@@ -547,6 +633,7 @@ class SymbolsManager : public EnhancedObject {
                   AssumeCondition(!lsHighLevelSymbols.foreachDo([symbol](const Symbol& iterate)
                      {  return &iterate != symbol; }))
 #endif
+                  otHighLevelSymbols.remove(*symbol);
                   COL::TList<Symbol, Symbol::Registration>::Cursor cursor(lsHighLevelSymbols);
                   cursor.gotoReference(*symbol);
                   lsHighLevelSymbols.freeAt(cursor);
@@ -564,6 +651,7 @@ class SymbolsManager : public EnhancedObject {
       {  Symbol* result = new typename TypeTraits::DefinedSymbol(definition);
          lsDefinedSymbols.insertNewAtEnd(result);
          result->setOrder(lsDefinedSymbols.count());
+         otDefinedSymbols.add(*result);
          return result;
       }
    template <class TypeTraits>
@@ -577,54 +665,37 @@ class SymbolsManager : public EnhancedObject {
                && !symbol->hasOrder())
          lsDefinedSymbols.insertNewAtEnd(symbol);
          symbol->setOrder(lsDefinedSymbols.count());
+         otDefinedSymbols.add(*symbol);
          return *symbol;
       }
    Symbol* createMarkedNoiseSymbol(int order)
-      {  Symbol* result = new MarkedNoiseSymbol(order);
+      {  // marked symbols share the order of an existing symbol and they are not indexed
+         Symbol* result = new MarkedNoiseSymbol(order);
          lsNoiseSymbols.insertNewAtEnd(result);
          return result;
       }
-#if defined(__clang__)
-#pragma GCC diagnostic push
-#pragma GCC diagnostic ignored "-Wempty-body"
-#endif
    Symbol& findDefinedSymbol(int index) const
-      {  COL::TList<Symbol, Symbol::Registration>::Cursor cursor(lsDefinedSymbols);
-         Symbol* result = nullptr;
-         while (cursor.setToPrevious() && (result = &cursor.elementSAt())->getOrder() > index);
-         AssumeCondition(cursor.isValid() && result->getOrder() == index)
+      {  Symbol* result = otDefinedSymbols.locate(index);
+         AssumeCondition(result && result->getOrder() == index)
          return *result;
       }
    Symbol& findCentralSymbol(int index) const
-      {  COL::TList<Symbol, Symbol::Registration>::Cursor cursor(lsCentralSymbols);
-         Symbol* result = nullptr;
-         while (cursor.setToPrevious() && (result = &cursor.elementSAt())->getOrder() > index);
-         AssumeCondition(cursor.isValid() && result->getOrder() == index)
+      {  Symbol* result = otCentralSymbols.locate(index);
+         AssumeCondition(result && result->getOrder() == index)
          return *result;
       }
    Symbol& findNoiseSymbol(int index) const
-      {  COL::TList<Symbol, Symbol::Registration>::Cursor cursor(lsNoiseSymbols);
-         Symbol* result = nullptr;
-         while (cursor.setToPrevious() && (result = &cursor.elementSAt())->getOrder() > index);
-         AssumeCondition(cursor.isValid() && result->getOrder() == index)
+      {  Symbol* result = otNoiseSymbols.locate(index);
+         AssumeCondition(result && result->getOrder() == index)
          return *result;
       }
    Symbol& findHighLevelSymbol(int index) const
-      {  COL::TList<Symbol, Symbol::Registration>::Cursor cursor(lsHighLevelSymbols);
-         Symbol* result = nullptr;
-         while (cursor.setToPrevious() && (result = &cursor.elementSAt())->getOrder() > index);
-         AssumeCondition(cursor.isValid() && result->getOrder() == index)
+      {  Symbol* result = otHighLevelSymbols.locate(index);
+         AssumeCondition(result && result->getOrder() == index)
          return *result;
       }
    Symbol* locateHighLevelSymbol(int index) const
-      {  COL::TList<Symbol, Symbol::Registration>::Cursor cursor(lsHighLevelSymbols);
-         Symbol* result = nullptr;
-         while (cursor.setToPrevious() && (result = &cursor.elementSAt())->getOrder() > index);
-         return cursor.isValid() ? result : nullptr;
-      }
-#if defined(__clang__)
-#pragma GCC diagnostic pop
-#endif
+      {  return otHighLevelSymbols.locateLastBefore(index); }
 
    int getCountCentralSymbols() const { return lsCentralSymbols.count(); }
    int getCountNoiseSymbols() const { return lsNoiseSymbols.count(); }
@@ -632,7 +703,19 @@ class SymbolsManager : public EnhancedObject {
    int getMaxHighLevelSymbolOrder() const { return uHighLevelSymbolsCounter; }
 
    void moveCountedSymbolsTo(SymbolsManager& receiver)
-      {  lsCentralSymbols.moveAllTo(receiver.lsCentralSymbols);
+      {  lsCentralSymbols.foreachSDo([&receiver](Symbol& symbol)
+            {  receiver.otCentralSymbols.add(symbol); return true; });
+         lsNoiseSymbols.foreachSDo([&receiver](Symbol& symbol)
+            {  if (symbol.getType() != Symbol::TMarkedNoise)
+                  receiver.otNoiseSymbols.add(symbol);
+               return true;
+            });
+         lsDefinedSymbols.foreachSDo([&receiver](Symbol& symbol)
+            {  receiver.otDefinedSymbols.add(symbol); return true; });
+         otCentralSymbols.clear();
+         otNoiseSymbols.clear();
+         otDefinedSymbols.clear();
+         lsCentralSymbols.moveAllTo(receiver.lsCentralSymbols);
          lsNoiseSymbols.moveAllTo(receiver.lsNoiseSymbols);
          lsDefinedSymbols.moveAllTo(receiver.lsDefinedSymbols);
       }
@@ -644,6 +727,8 @@ class SymbolsManager : public EnhancedObject {
             AssumeCondition(beforeReceiver->getOrder() < symbol.getOrder())
             receiverCursor.gotoReference(*beforeReceiver);
          }
+         otHighLevelSymbols.remove(symbol);
+         receiver.otHighLevelSymbols.add(symbol);
          lsHighLevelSymbols.moveTo(receiver.lsHighLevelSymbols, COL::List::ExtendedReplaceParameters()
                .setRemoveExact().setInsertionPosition(COL::VirtualCollection::RPAfter),
                &cursor, &receiverCursor);
@@ -651,18 +736,22 @@ class SymbolsManager : public EnhancedObject {
    void freeCentralSymbolsAfter(int centralOrder)
       {  while (!lsCentralSymbols.isEmpty() && lsCentralSymbols.getLast().getOrder() > centralOrder)
             lsCentralSymbols.freeLast();
+         otCentralSymbols.removeAfter(centralOrder);
       }
    void freeNoiseSymbolsAfter(int noiseOrder)
       {  while (!lsNoiseSymbols.isEmpty() && lsNoiseSymbols.getLast().getOrder() > noiseOrder)
             lsNoiseSymbols.freeLast();
+         otNoiseSymbols.removeAfter(noiseOrder);
       }
    void freeDefinedSymbolsAfter(int definedOrder)
       {  while (!lsDefinedSymbols.isEmpty() && lsDefinedSymbols.getLast().getOrder() > definedOrder)
             lsDefinedSymbols.freeLast();
+         otDefinedSymbols.removeAfter(definedOrder);
       }
    void freeHighLevelSymbolsAfter(int highLevelOrder)
       {  while (!lsHighLevelSymbols.isEmpty() && lsHighLevelSymbols.getLast().getOrder() > highLevelOrder)
             lsHighLevelSymbols.freeLast();
+         otHighLevelSymbols.removeAfter(highLevelOrder);
          uHighLevelSymbolsCounter = highLevelOrder;
       }
 };
@@ -0,0 +1,368 @@
+/**************************************************************************/
+/*                                                                        */
+/*  This file is part of FLDLib                                           */
+/*                                                                        */
+/*  Copyright (C) 2015-2017                                               */
+/*    CEA (Commissariat a l'Energie Atomique et aux Energies              */
+/*         Alternatives)                                                  */
+/*                                                                        */
+/*  you can redistribute it and/or modify it under the terms of the GNU   */
+/*  Lesser General Public License as published by the Free Software       */
+/*  Foundation, version 2.1.                                              */
+/*                                                                        */
+/*  It is distributed in the hope that it will be useful,                 */
+/*  but WITHOUT ANY WARRANTY; without even the implied warranty of        */
+/*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         */
+/*  GNU Lesser General Public License for more details.                   */
+/*                                                                        */
+/*  See the GNU Lesser General Public License version 2.1                 */
+/*  for more details (enclosed in the file LICENSE).                      */
+/*                                                                        */
+/**************************************************************************/
+
+/////////////////////////////////
+//
+// Library   : NumericalDomains
+// Unit      : FloatExact
+// File      : FloatExactMultiDouble.h
+// Description :
+//   Definition of the real numbers of the exact domain as unevaluated sums
+//   of 2 (double-double), 3 or 4 (quad-double) native doubles.
+//
+
+#ifndef NumericalDomains_FloatExactMultiDoubleH
+#define NumericalDomains_FloatExactMultiDoubleH
+
+#include <cmath>
+#include <cfloat>
+
+namespace NumericalDomains { namespace DDoubleExact {
+
+namespace DMultiDouble {
+
+// error-free transformations: sum + error == a + b, prod + error == a * b
+inline void
+twoSum(double a, double b, double& sum, double& error) {
+   double result = a + b;
+   double bVirtual = result - a;
+   error = (a - (result - bVirtual)) + (b - bVirtual);
+   sum = result;
+}
+
+// requires |a| >= |b|
+inline void
+quickTwoSum(double a, double b, double& sum, double& error) {
+   double result = a + b;
+   error = b - (result - a);
+   sum = result;
+}
+
+inline void
+twoProd(double a, double b, double& prod, double& error) {
+   double result = a * b;
+   error = std::fma(a, b, -result);
+   prod = result;
+}
+
+} // end of namespace DMultiDouble
+
+/********************************************************************/
+/* Definition of the template class TMultiDoubleReal                */
+/*   the value is adLimbs[0] + ... + adLimbs[ULimbs-1] with limbs   */
+/*   of decreasing magnitude. The arithmetic operations only rely   */
+/*   on the native IEEE-754 operations of the host in round to      */
+/*   nearest mode. The directed roundings widen the last limb with  */
+/*   the error bound of the operation. The operations without fast  */
+/*   algorithm go through TypeBuiltReal.                            */
+/********************************************************************/
+
+template <class TypeBuiltReal, class TypeBuiltDouble, int ULimbs>
+class TMultiDoubleReal {
+  public:
+   typedef typename TypeBuiltReal::ReadParameters ReadParameters;
+   typedef typename TypeBuiltReal::WriteParameters WriteParameters;
+   typedef typename TypeBuiltReal::IntConversion IntConversion;
+   typedef typename TypeBuiltReal::FloatConversion FloatConversion;
+   typedef typename TypeBuiltReal::BaseDouble BaseDouble;
+   typedef typename TypeBuiltReal::Exponent Exponent;
+
+   static const int BitSizeMantissa = TypeBuiltReal::BitSizeMantissa;
+   static const int BitSizeExponent = TypeBuiltReal::BitSizeExponent;
+
+  private:
+   typedef TMultiDoubleReal<TypeBuiltReal, TypeBuiltDouble, ULimbs> thisType;
+
+   double adLimbs[ULimbs];
+
+   // 32 units of the last limb, above the error of the fast algorithms
+   static double relativeErrorBound() { return std::ldexp(1.0, 5-53*ULimbs); }
+   static void renormalize(double* terms, int count, double* result);
+   static void renormalizeLevels(const double* highs, const double* lows, const double* otherLows,
+         double* result);
+   static double leadingDouble(const TypeBuiltReal& source);
+   static TypeBuiltReal builtReal(double source);
+
+   bool isFinite() const { return std::isfinite(adLimbs[0]); }
+   void setDouble(double value)
+      {  adLimbs[0] = value;
+         for (int index = 1; index < ULimbs; ++index)
+            adLimbs[index] = 0.0;
+      }
+   void widen(double magnitude, const ReadParameters& params);
+   void minusMultiple(const thisType& source, double factor);
+
+  public:
+   TMultiDoubleReal() { setDouble(0.0); }
+   TMultiDoubleReal(unsigned int value) { setDouble((double) value); }
+   TMultiDoubleReal(const TypeBuiltReal& source) { setReal(source); }
+   TMultiDoubleReal(const thisType& source) = default;
+   thisType& operator=(const thisType& source) = default;
+
+   // conversions with the software reals
+   void setReal(const TypeBuiltReal& source);
+   TypeBuiltReal asReal() const;
+   void setValue(double value) { setDouble(value); }
+   void setValue(float value) { setDouble((double) value); }
+   void setValue(long double value);
+   const double& operator[](int index) const { return adLimbs[index]; }
+
+   static int bitSizeMantissa() { return BitSizeMantissa; }
+   static int bitSizeExponent() { return BitSizeExponent; }
+
+   void clear() { setDouble(0.0); }
+   thisType& opposite()
+      {  for (int index = 0; index < ULimbs; ++index)
+            adLimbs[index] = -adLimbs[index];
+         return *this;
+      }
+   void setInfty() { setDouble(HUGE_VAL); }
+   void setSNaN() { setDouble(std::nan("")); }
+   bool isZero() const { return adLimbs[0] == 0.0; }
+   bool isNaN() const { return std::isnan(adLimbs[0]); }
+   bool isNegative() const { return std::signbit(adLimbs[0]); }
+   bool isPositive() const { return !std::signbit(adLimbs[0]); }
+
+   ComparisonResult compareValue(const thisType& source) const;
+   bool operator==(const thisType& source) const { return compareValue(source) == CREqual; }
+   bool operator!=(const thisType& source) const
+      {  ComparisonResult result = compareValue(source);
+         return (result == CRLess) || (result == CRGreater);
+      }
+   bool operator<(const thisType& source) const { return compareValue(source) == CRLess; }
+   bool operator>(const thisType& source) const { return compareValue(source) == CRGreater; }
+   bool operator<=(const thisType& source) const
+      {  ComparisonResult result = compareValue(source);
+         return (result == CRLess) || (result == CREqual);
+      }
+   bool operator>=(const thisType& source) const
+      {  ComparisonResult result = compareValue(source);
+         return (result == CRGreater) || (result == CREqual);
+      }
+
+   thisType& plusAssign(const thisType& source, ReadParameters& params);
+   thisType& minusAssign(const thisType& source, ReadParameters& params)
+      {  thisType opposite(source);
+         return plusAssign(opposite.opposite(), params);
+      }
+   thisType& multAssign(const thisType& source, ReadParameters& params);
+   thisType& divAssign(const thisType& source, ReadParameters& params);
+   thisType& sqrtAssign();
+
+   void setInteger(const IntConversion& value, ReadParameters& /* params */)
+      {  setDouble(value.isUnsigned() ? (double) value.asUnsignedInt() : (double) value.asInt()); }
+
+   // operations computed by TypeBuiltReal
+   void retrieveInteger(IntConversion& result, ReadParameters& params) const
+      {  asReal().retrieveInteger(result, params); }
+   void readDecimal(STG::IOObject::ISBase& in, ReadParameters& params)
+      {  TypeBuiltReal real;
+         real.readDecimal(in, params);
+         setReal(real);
+      }
+   void write(STG::IOObject::OSBase& out, const WriteParameters& params) const
+      {  asReal().write(out, params); }
+   void expAssign(BaseDouble& errorMin, BaseDouble& errorMax, ReadParameters& params)
+      {  TypeBuiltReal real = asReal();
+         real.expAssign(errorMin, errorMax, params);
+         setReal(real);
+      }
+   void logAssign(BaseDouble& errorMin, BaseDouble& errorMax, ReadParameters& params)
+      {  TypeBuiltReal real = asReal();
+         real.logAssign(errorMin, errorMax, params);
+         setReal(real);
+      }
+};
+
+template <class TypeBuiltReal, class TypeBuiltDouble, int ULimbs>
+inline void
+TMultiDoubleReal<TypeBuiltReal, TypeBuiltDouble, ULimbs>::renormalize(double* terms, int count,
+      double* result) {
+   // error-free accumulation from the smallest terms
+   double sum = terms[count-1];
+   for (int index = count-2; index >= 0; --index)
+      DMultiDouble::twoSum(terms[index], sum, sum, terms[index+1]);
+
+   // extraction of the limbs, the last one absorbs the remaining terms
+   int limb = 0, index = 1;
+   for (; index < count && limb < ULimbs-1; ++index) {
+      double error;
+      DMultiDouble::twoSum(sum, terms[index], sum, error);
+      if (error != 0.0) {
+         result[limb++] = sum;
+         sum = error;
+      };
+   };
+   for (; index < count; ++index)
+      sum += terms[index];
+   result[limb] = sum;
+   while (++limb < ULimbs)
+      result[limb] = 0.0;
+}
+
+template <class TypeBuiltReal, class TypeBuiltDouble, int ULimbs>
+inline void
+TMultiDoubleReal<TypeBuiltReal, TypeBuiltDouble, ULimbs>::renormalizeLevels(const double* highs,
+      const double* lows, const double* otherLows, double* result) {
+   // the level l gathers highs[l], lows[l-1], otherLows[l-1] if any and the rounding
+   // errors of the level l-1. The last level is summed with the native operations.
+   double levels[ULimbs], errors[2*ULimbs*ULimbs];
+   int firstError = 0, errorCount = 0;
+   levels[0] = highs[0];
+   for (int level = 1; level < ULimbs-1; ++level) {
+      double sum;
+      int levelError = errorCount;
+      DMultiDouble::twoSum(highs[level], lows[level-1], sum, errors[errorCount++]);
+      if (otherLows)
+         DMultiDouble::twoSum(sum, otherLows[level-1], sum, errors[errorCount++]);
+      for (int index = firstError; index < levelError; ++index)
+         DMultiDouble::twoSum(sum, errors[index], sum, errors[errorCount++]);
+      firstError = levelError;
+      levels[level] = sum;
+   };
+   double last = highs[ULimbs-1] + lows[ULimbs-2];
+   if (otherLows)
+      last += otherLows[ULimbs-2];
+   for (int index = firstError; index < errorCount; ++index)
+      last += errors[index];
+   last += lows[ULimbs-1];
+   if (otherLows)
+      last += otherLows[ULimbs-1];
+   levels[ULimbs-1] = last;
+   renormalize(levels, ULimbs, result);
+}
+
+template <class TypeBuiltReal, class TypeBuiltDouble, int ULimbs>
+inline void
+TMultiDoubleReal<TypeBuiltReal, TypeBuiltDouble, ULimbs>::widen(double magnitude,
+      const ReadParameters& params) {
+   if (params.isNearestRound() || !isFinite() || (params.isZeroRound() && isZero()))
+      return;
+   bool isUpper = params.isHighestRound() || (params.isZeroRound() && isNegative());
+   double delta = std::fabs(magnitude) * relativeErrorBound();
+   double& last = adLimbs[ULimbs-1];
+   last = std::nextafter(isUpper ? (last + delta) : (last - delta), isUpper ? HUGE_VAL : -HUGE_VAL);
+   double terms[ULimbs];
+   for (int index = 0; index < ULimbs; ++index)
+      terms[index] = adLimbs[index];
+   renormalize(terms, ULimbs, adLimbs);
+}
+
+template <class TypeBuiltReal, class TypeBuiltDouble, int ULimbs>
+inline ComparisonResult
+TMultiDoubleReal<TypeBuiltReal, TypeBuiltDouble, ULimbs>::compareValue(const thisType& source) const {
+   double first = adLimbs[0], second = source.adLimbs[0];
+   if (std::isnan(first) || std::isnan(second))
+      return CRNonComparable;
+   if (!std::isfinite(first) || !std::isfinite(second)
+         || std::fabs(first - second) > std::ldexp(std::fmax(std::fabs(first), std::fabs(second)), -50))
+      return (first < second) ? CRLess : ((first > second) ? CRGreater : CREqual);
+   thisType difference(*this);
+   ReadParameters params;
+   params.setNearestRound();
+   difference.minusAssign(source, params);
+   return (difference.adLimbs[0] < 0.0) ? CRLess
+      : ((difference.adLimbs[0] > 0.0) ? CRGreater : CREqual);
+}
+
+template <class TypeBuiltReal, class TypeBuiltDouble, int ULimbs>
+inline TMultiDoubleReal<TypeBuiltReal, TypeBuiltDouble, ULimbs>&
+TMultiDoubleReal<TypeBuiltReal, TypeBuiltDouble, ULimbs>::plusAssign(const thisType& source,
+      ReadParameters& params) {
+   if (!isFinite() || !source.isFinite()) {
+      setDouble(adLimbs[0] + source.adLimbs[0]);
+      return *this;
+   };
+   double magnitude = std::fmax(std::fabs(adLimbs[0]), std::fabs(source.adLimbs[0]));
+   if (ULimbs == 2) { // accurate double-double addition
+      double sum, error, lowSum, lowError;
+      DMultiDouble::twoSum(adLimbs[0], source.adLimbs[0], sum, error);
+      DMultiDouble::twoSum(adLimbs[1], source.adLimbs[1], lowSum, lowError);
+      error += lowSum;
+      DMultiDouble::quickTwoSum(sum, error, sum, error);
+      error += lowError;
+      DMultiDouble::quickTwoSum(sum, error, adLimbs[0], adLimbs[1]);
+   }
+   else {
+      double sums[ULimbs], errors[ULimbs];
+      for (int index = 0; index < ULimbs; ++index)
+         DMultiDouble::twoSum(adLimbs[index], source.adLimbs[index], sums[index], errors[index]);
+      renormalizeLevels(sums, errors, nullptr, adLimbs);
+   };
+   widen(magnitude, params);
+   return *this;
+}
+
+template <class TypeBuiltReal, class TypeBuiltDouble, int ULimbs>
+inline TMultiDoubleReal<TypeBuiltReal, TypeBuiltDouble, ULimbs>&
+TMultiDoubleReal<TypeBuiltReal, TypeBuiltDouble, ULimbs>::multAssign(const thisType& source,
+      ReadParameters& params) {
+   if (!isFinite() || !source.isFinite()) {
+      setDouble(adLimbs[0] * source.adLimbs[0]);
+      return *this;
+   };
+   if (ULimbs == 2) {
+      double prod, error;
+      DMultiDouble::twoProd(adLimbs[0], source.adLimbs[0], prod, error);
+      error += adLimbs[0] * source.adLimbs[1] + adLimbs[1] * source.adLimbs[0];
+      DMultiDouble::quickTwoSum(prod, error, adLimbs[0], adLimbs[1]);
+      if (!isFinite())
+         setDouble(adLimbs[0]);
+      widen(adLimbs[0], params);
+      return *this;
+   };
+   // the level l gathers the products a[i]*b[l-i] and the errors of the level l-1,
+   // the products of the last level are not exact and the next levels are neglected
+   // errors[firstError..errorCount[ are the errors of the previous level
+   double errors[2*ULimbs*ULimbs], levels[ULimbs];
+   int firstError = 0, errorCount = 0;
+   for (int level = 0; level < ULimbs-1; ++level) {
+      double sum, product;
+      int levelError = errorCount;
+      DMultiDouble::twoProd(adLimbs[0], source.adLimbs[level], sum, errors[errorCount++]);
+      for (int index = 1; index <= level; ++index) {
+         DMultiDouble::twoProd(adLimbs[index], source.adLimbs[level-index], product,
+               errors[errorCount++]);
+         DMultiDouble::twoSum(sum, product, sum, errors[errorCount++]);
+      };
+      for (int index = firstError; index < levelError; ++index)
+         DMultiDouble::twoSum(sum, errors[index], sum, errors[errorCount++]);
+      firstError = levelError;
+      levels[level] = sum;
+   };
+   double last = 0.0;
+   for (int index = 0; index < ULimbs; ++index)
+      last += adLimbs[index] * source.adLimbs[ULimbs-1-index];
+   for (int index = firstError; index < errorCount; ++index)
+      last += errors[index];
+   levels[ULimbs-1] = last;
+   renormalize(levels, ULimbs, adLimbs);
+   if (!isFinite())
+      setDouble(adLimbs[0]);
+   widen(adLimbs[0], params);
+   return *this;
+}
+
+}} // end of namespace NumericalDomains::DDoubleExact
+
+#endif // NumericalDomains_FloatExactMultiDoubleH
+
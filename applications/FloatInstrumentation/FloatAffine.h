@@ -304,6 +304,7 @@ class TMergeMemory {
       }
    bool isFirst() const { return next.isFirst(); }
    bool isComplete() const { return next.isComplete(); }
+   void setFirst() { next.setFirst(); }
 };
 
 template <typename TypeIterator, class TypeMergeMemory>
@@ -369,6 +370,7 @@ class TPackedMergeMemory {
       }
    bool isFirst() const { return next.isFirst(); }
    bool isComplete() const { return next.isComplete(); }
+   void setFirst() { merge.removeAll(); next.setFirst(); }
 };
 
 template <typename T1, class TypeMergeMemory>
@@ -404,6 +406,7 @@ class MergeMemory {
       {  fComplete = isComplete; return *this; }
    bool isFirst() const { return fFirst; }
    bool isComplete() const { return fComplete; }
+   void setFirst() { fFirst = true; }
    bool operator<<(BaseExecutionPath::end)
       {  if (fComplete)
             fFirst = false;
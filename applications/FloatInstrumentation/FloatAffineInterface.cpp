@@ -172,6 +172,11 @@ ExecutionPath::setSupportPureZonotope() {
    DAffine::ExecutionPath::setSupportPureZonotope();
 }
 
+void
+ExecutionPath::setSupportBinaryTrace() {
+   DAffine::ExecutionPath::setSupportBinaryTrace();
+}
+
 void
 ExecutionPath::setTrackErrorOrigin() {
    DAffine::ExecutionPath::setTrackErrorOrigin();
@@ -207,6 +212,11 @@ ExecutionPath::finalizeGlobals() {
    DAffine::ExecutionPath::finalizeGlobals();
 }
 
+void
+ExecutionPath::runAllPaths(const std::function<void()>& entry) {
+   DAffine::ExecutionPath::runAllPaths(entry);
+}
+
 void
 ExecutionPath::flushOut() {
    DAffine::ExecutionPath::flushOut();
@@ -426,6 +426,7 @@ class ExecutionPath {
    static void setSupportThreshold();
    static void setSupportFirstFollowFloat();
    static void setSupportPureZonotope();
+   static void setSupportBinaryTrace();
    static void setTrackErrorOrigin();
    static void setSupportMapSymbols();
    static void setLimitNoiseSymbolsNumber(int limit);
@@ -433,6 +434,7 @@ class ExecutionPath {
 
    static void initializeGlobals(const char* fileSuffix);
    static void finalizeGlobals();
+   static void runAllPaths(const std::function<void()>& entry);
    static bool doesSupportUnstableInLoop();
    class Initialization {
      public:
@@ -444,10 +446,12 @@ class ExecutionPath {
       void setSupportThreshold() { ExecutionPath::setSupportThreshold(); }
       void setSupportFirstFollowFloat() { ExecutionPath::setSupportFirstFollowFloat(); }
       void setSupportPureZonotope() { ExecutionPath::setSupportPureZonotope(); }
+      void setSupportBinaryTrace() { ExecutionPath::setSupportBinaryTrace(); }
       void setTrackErrorOrigin() { ExecutionPath::setTrackErrorOrigin(); }
       void setSupportMapSymbols() { ExecutionPath::setSupportMapSymbols(); }
       void setLimitNoiseSymbolsNumber(int limit) { ExecutionPath::setLimitNoiseSymbolsNumber(limit); }
       void setResultFile(const char* fileSuffix) { initializeGlobals(fileSuffix); }
+      void runAllPaths(const std::function<void()>& entry) { ExecutionPath::runAllPaths(entry); }
       void setSimplificationTriggerPercent(double percent) { ExecutionPath::setSimplificationTriggerPercent(percent); }
       ~Initialization() { finalizeGlobals(); }
    };
@@ -39,6 +39,7 @@
 #include "NumericalDomains/FloatExactBaseGeneric.template"
 #endif
 
+#include <cfenv>
 #include <fstream>
 #include <sstream>
 
@@ -29,6 +29,7 @@
 //   Implementation of a class of comparison between floating points
 //
 
+#include <cfenv>
 #include <fstream>
 #include <sstream>
 
@@ -122,6 +123,11 @@ ExecutionPath::finalizeGlobals() {
    DDoubleExact::ExecutionPath::finalizeGlobals();
 }
 
+void
+ExecutionPath::runAllPaths(const std::function<void()>& entry) {
+   DDoubleExact::ExecutionPath::runAllPaths(entry);
+}
+
 void
 ExecutionPath::flushOut() {
    DDoubleExact::ExecutionPath::flushOut();
@@ -134,6 +134,11 @@ ExecutionPath::finalizeGlobals() {
    DDoubleInterval::ExecutionPath::finalizeGlobals();
 }
 
+void
+ExecutionPath::runAllPaths(const std::function<void()>& entry) {
+   DDoubleInterval::ExecutionPath::runAllPaths(entry);
+}
+
 void
 ExecutionPath::flushOut() {
    DDoubleInterval::ExecutionPath::flushOut();
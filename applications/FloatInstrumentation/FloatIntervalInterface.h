@@ -334,6 +334,7 @@ class ExecutionPath {
    static void setSupportFirstFollowFloat();
    static void initializeGlobals(const char* fileSuffix);
    static void finalizeGlobals();
+   static void runAllPaths(const std::function<void()>& entry);
    class Initialization {
      public:
       Initialization() {}
@@ -344,6 +345,7 @@ class ExecutionPath {
       void setSupportThreshold() { ExecutionPath::setSupportThreshold(); }
       void setSupportFirstFollowFloat() { ExecutionPath::setSupportFirstFollowFloat(); }
       void setResultFile(const char* fileSuffix) { initializeGlobals(fileSuffix); }
+      void runAllPaths(const std::function<void()>& entry) { ExecutionPath::runAllPaths(entry); }
       ~Initialization() { finalizeGlobals(); }
    };
    static void flushOut();
@@ -143,6 +143,7 @@ class ExecutionPathContract : public BaseExecutionPath {
    bool doesFollowFlow() const { return false; }
    bool hasOutput() const { return false; }
    bool hasThreshold() const { return false; }
+   bool doesSupportBinaryTrace() const { return false; }
 
    bool hasSimplificationTriggerPercent() const { return false; }
    BuiltReal getSimplificationTriggerPercent() const { return BuiltReal(); }
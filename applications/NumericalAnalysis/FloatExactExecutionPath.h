@@ -142,6 +142,7 @@ class ExecutionPathContract : public BaseExecutionPath {
    bool doesFollowFlow() const { return false; }
    bool hasOutput() const { return false; }
    bool doesAssumeInput() const { return true; }
+   bool hasLazyImplementation() const { return false; }
 
    void assumeDomain(char /* prefix */) const {}
    void assumeDomain(const char* /* prefix */) const {}
@@ -265,26 +266,27 @@ class TBaseFloatExact : public TypeExecutionPath {
                BuiltReal relativeError;
                source.retrieveRelativeError(relativeError);
                if (!relativeError.isZero()) {
+                  const BuiltReal& realValue = source.real();
                   if (doesAssume && inherited::hasThreshold() && inherited::doesAssumeInput()) {
-                     if (source.real().isPositive())
-                        inherited::assumeThresholdDetection(relativeError, source.real());
+                     if (realValue.isPositive())
+                        inherited::assumeThresholdDetection(relativeError, realValue);
                      else {
-                        BuiltReal sourceReal(source.real());
+                        BuiltReal sourceReal(realValue);
                         sourceReal.opposite();
                         inherited::assumeThresholdDetection(relativeError, sourceReal);
                      };
                   };
                   if (hasOutput && mode == BaseExecutionPath::SVNone) {
                      if (inherited::hasThreshold()) {
-                        if (source.real().isPositive())
-                           inherited::updateThresholdDetection(relativeError, source.real());
+                        if (realValue.isPositive())
+                           inherited::updateThresholdDetection(relativeError, realValue);
                         else {
-                           BuiltReal sourceReal(source.real());
+                           BuiltReal sourceReal(realValue);
                            sourceReal.opposite();
                            inherited::updateThresholdDetection(relativeError, sourceReal);
                         };
                      };
-                     inherited::updateMaximalAccuracy(relativeError, source.real());
+                     inherited::updateMaximalAccuracy(relativeError, realValue);
                   };
                };
             }
@@ -297,8 +299,8 @@ class TBaseFloatExact : public TypeExecutionPath {
          bool hasOutput = inherited::hasOutput();
          if (doesAssume || hasOutput) {
             BuiltReal diff;
-            source.retrieveReal(source.bfImplementation, diff);
-            diff.minusAssign(source.brReal, inherited::nearestParams());
+            source.retrieveReal(source.implementation(), diff);
+            diff.minusAssign(source.real(), inherited::nearestParams());
             inherited::nearestParams().clear();
 
             if (doesAssume && inherited::doesAssumeInput()) {
@@ -66,6 +66,13 @@ template class NumericalDomains::DDoubleExact::TBuiltFloat<FLOAT_REAL_BITS_NUMBE
 template class NumericalDomains::DDoubleExact::TBuiltFloat<FLOAT_REAL_BITS_NUMBER, 52, 11>;
 template class NumericalDomains::DDoubleExact::TBuiltFloat<FLOAT_REAL_BITS_NUMBER, LongDoubleFloatDigits::UBitSizeMantissa, LongDoubleFloatDigits::UBitSizeExponent>;
 
+#ifdef FLOAT_MULTI_DOUBLE_REAL
+#include "NumericalLattices/FloatExactMultiDouble.template"
+
+template class NumericalDomains::DDoubleExact::TMultiDoubleReal<NumericalDomains::DDoubleExact::TBuiltReal<FLOAT_REAL_BITS_NUMBER>,
+   NumericalDomains::DDoubleExact::TBuiltFloat<FLOAT_REAL_BITS_NUMBER, 52, 11>, (FLOAT_REAL_BITS_NUMBER+52)/53>;
+#endif
+
 #else
 #include "NumericalLattices/FloatExactBaseTypesGeneric.template"
 
@@ -96,6 +103,13 @@ template class NumericalDomains::DDoubleExact::TGBuiltFloat<Numerics::UnsignedLo
 template class NumericalDomains::DDoubleExact::TGBuiltFloat<Numerics::UnsignedLongBaseStoreTraits, FLOAT_REAL_BITS_NUMBER, 52, 11>;
 template class NumericalDomains::DDoubleExact::TGBuiltFloat<Numerics::UnsignedLongBaseStoreTraits, FLOAT_REAL_BITS_NUMBER, LongDoubleFloatDigits::UBitSizeMantissa, LongDoubleFloatDigits::UBitSizeExponent>;
 
+#ifdef FLOAT_MULTI_DOUBLE_REAL
+#include "NumericalLattices/FloatExactMultiDouble.template"
+
+template class NumericalDomains::DDoubleExact::TMultiDoubleReal<NumericalDomains::DDoubleExact::TGBuiltReal<Numerics::UnsignedLongBaseStoreTraits, FLOAT_REAL_BITS_NUMBER>,
+   NumericalDomains::DDoubleExact::TGBuiltFloat<Numerics::UnsignedLongBaseStoreTraits, FLOAT_REAL_BITS_NUMBER, 52, 11>, (FLOAT_REAL_BITS_NUMBER+52)/53>;
+#endif
+
 template class Numerics::DInteger::TGBigCellIntAlgo<Numerics::UnsignedLongBaseStoreTraits, Numerics::DInteger::TGCellIntegerTraits<Numerics::UnsignedLongBaseStoreTraits, 2> >;
 
 #else // defined(FLOAT_GENERIC_BASE_UNSIGNED)
@@ -124,5 +138,12 @@ template class NumericalDomains::DDoubleExact::TGBuiltFloat<Numerics::UnsignedBa
 template class NumericalDomains::DDoubleExact::TGBuiltFloat<Numerics::UnsignedBaseStoreTraits, FLOAT_REAL_BITS_NUMBER, 52, 11>;
 template class NumericalDomains::DDoubleExact::TGBuiltFloat<Numerics::UnsignedBaseStoreTraits, FLOAT_REAL_BITS_NUMBER, LongDoubleFloatDigits::UBitSizeMantissa, LongDoubleFloatDigits::UBitSizeExponent>;
 
+#ifdef FLOAT_MULTI_DOUBLE_REAL
+#include "NumericalLattices/FloatExactMultiDouble.template"
+
+template class NumericalDomains::DDoubleExact::TMultiDoubleReal<NumericalDomains::DDoubleExact::TGBuiltReal<Numerics::UnsignedBaseStoreTraits, FLOAT_REAL_BITS_NUMBER>,
+   NumericalDomains::DDoubleExact::TGBuiltFloat<Numerics::UnsignedBaseStoreTraits, FLOAT_REAL_BITS_NUMBER, 52, 11>, (FLOAT_REAL_BITS_NUMBER+52)/53>;
+#endif
+
 #endif
 #endif
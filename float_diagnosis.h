@@ -87,6 +87,34 @@ typedef long double old_long_double;
    NumericalDomains::DAffine::BaseFloatAffine::splitBranches(_oldSourceInfo##ident.first, _oldSourceInfo##ident.second);
 #else // FLOAT_LOOP_UNSTABLE
 
+#ifndef FLOAT_INTERFACE
+#define FLOAT_DECLARE_PARALLEL_PATHS(ident)                                                      \
+   NumericalDomains::DAffine::ParallelPaths _parallelPaths##ident(_pathExplorer##ident);
+#define FLOAT_SPLIT_PARALLEL_PATHS(ident, x)                                                     \
+      if (_doesIterate##ident && _parallelPaths##ident.isActive()) {                             \
+         if (_parallelPaths##ident.split()) {                                                    \
+            if (_parallelPaths##ident.isWorker())                                                \
+               _mergeMemory##ident.setFirst();                                                   \
+            else {                                                                               \
+               while (_parallelPaths##ident.readNextUnit())                                      \
+                  _mergeMemory##ident.setCurrentComplete(_parallelPaths##ident.reader() << x) << x;\
+               _doesIterate##ident = _parallelPaths##ident.hasSequentialRemainder();             \
+            }                                                                                    \
+         }                                                                                       \
+         else if (_parallelPaths##ident.isWorker())                                              \
+            _doesIterate##ident = !_parallelPaths##ident.isEndOfUnit();                          \
+      }
+#define FLOAT_TERMINATE_PARALLEL_PATHS(ident, x)                                                 \
+   if (_parallelPaths##ident.isWorker()) {                                                       \
+      _parallelPaths##ident.writer(!_mergeMemory##ident.isFirst()) << x;                         \
+      _parallelPaths##ident.terminateWorker();                                                   \
+   }
+#else
+#define FLOAT_DECLARE_PARALLEL_PATHS(ident) 
+#define FLOAT_SPLIT_PARALLEL_PATHS(ident, x) 
+#define FLOAT_TERMINATE_PARALLEL_PATHS(ident, x) 
+#endif // FLOAT_INTERFACE
+
 #define FLOAT_SPLIT_ALL(ident, merge, save) {                                                    \
    const char* _sourceFile##ident;                                                               \
    int _sourceLine##ident;                                                                       \
@@ -102,6 +130,7 @@ typedef long double old_long_double;
    NumericalDomains::DAffine::ExecutionPath::setCurrentPathExplorer(&_pathExplorer##ident);      \
    auto _mergeMemory##ident = NumericalDomains::DAffine::MergeMemory() >> merge;                 \
    auto _saveMemory##ident = NumericalDomains::DAffine::SaveMemory() << save;                    \
+   FLOAT_DECLARE_PARALLEL_PATHS(ident)                                                           \
    auto _oldSourceInfo##ident = NumericalDomains::DAffine::BaseFloatAffine::querySplitInfo();    \
    bool _doesIterate##ident;                                                                     \
    do {                                                                                          \
@@ -128,6 +157,7 @@ typedef long double old_long_double;
    NumericalDomains::DAffine::ExecutionPath::setCurrentPathExplorer(&_pathExplorer##ident);      \
    auto _mergeMemory##ident = NumericalDomains::DAffine::MergeMemory() >> merge;                 \
    auto _saveMemory##ident = NumericalDomains::DAffine::SaveMemory() << save;                    \
+   FLOAT_DECLARE_PARALLEL_PATHS(ident)                                                           \
    auto _oldSourceInfo##ident = NumericalDomains::DAffine::BaseFloatAffine::querySplitInfo();    \
    bool _doesIterate##ident;                                                                     \
    do {                                                                                          \
@@ -156,7 +186,9 @@ typedef long double old_long_double;
       _doesIterate##ident = (_mergeMemory##ident.setCurrentComplete(_isCompleteFlow##ident) << x);\
       if (_doesIterate##ident)                                                                   \
          _doesIterate##ident = !(_saveMemory##ident.setCurrentResult(_pathExplorer##ident.isFinished(NumericalDomains::DAffine::ExecutionPath::queryMode(_oldPathExplorer##ident))) >> load);\
+      FLOAT_SPLIT_PARALLEL_PATHS(ident, x)                                                       \
    } while (_doesIterate##ident);                                                                \
+   FLOAT_TERMINATE_PARALLEL_PATHS(ident, x)                                                      \
    NumericalDomains::DAffine::ExecutionPath::setFollowFlow(_oldDoesFollow##ident, _oldInputTraceFile##ident,\
          _oldSynchronisationFile##ident, _oldSynchronisationLine##ident);                        \
    NumericalDomains::DAffine::ExecutionPath::setCurrentPathExplorer(_oldPathExplorer##ident);    \
@@ -184,7 +216,9 @@ typedef long double old_long_double;
       _doesIterate##ident = (_mergeMemory##ident.setCurrentComplete(_isCompleteFlow##ident) << x);\
       if (_doesIterate##ident)                                                                   \
          _doesIterate##ident = !(_saveMemory##ident.setCurrentResult(_pathExplorer##ident.isFinished(NumericalDomains::DAffine::ExecutionPath::queryMode(_oldPathExplorer##ident))) >> load);\
+      FLOAT_SPLIT_PARALLEL_PATHS(ident, x)                                                       \
    } while (_doesIterate##ident);                                                                \
+   FLOAT_TERMINATE_PARALLEL_PATHS(ident, x)                                                      \
    NumericalDomains::DAffine::ExecutionPath::setFollowFlow(_oldDoesFollow##ident, _oldInputTraceFile##ident,\
          _oldSynchronisationFile##ident, _oldSynchronisationLine##ident);                        \
    NumericalDomains::DAffine::ExecutionPath::setCurrentPathExplorer(_oldPathExplorer##ident);    \
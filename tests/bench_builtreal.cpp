@@ -0,0 +1,117 @@
+/**************************************************************************/
+/*                                                                        */
+/*  This file is part of FLDLib                                           */
+/*                                                                        */
+/*  Copyright (C) 2014-2017                                               */
+/*    CEA (Commissariat a l'Energie Atomique et aux Energies              */
+/*         Alternatives)                                                  */
+/*                                                                        */
+/*  you can redistribute it and/or modify it under the terms of the GNU   */
+/*  Lesser General Public License as published by the Free Software       */
+/*  Foundation, version 2.1.                                              */
+/*                                                                        */
+/*  It is distributed in the hope that it will be useful,                 */
+/*  but WITHOUT ANY WARRANTY; without even the implied warranty of        */
+/*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         */
+/*  GNU Lesser General Public License for more details.                   */
+/*                                                                        */
+/*  See the GNU Lesser General Public License version 2.1                 */
+/*  for more details (enclosed in the file LICENSE).                      */
+/*                                                                        */
+/**************************************************************************/
+
+/////////////////////////////////
+//
+// Library   : tests
+// Unit      : bench
+// File      : bench_builtreal.cpp
+// Description :
+//   Throughput of the multiplication, the division and the square root
+//   of the reals used by the exact and affine domains, for the 32-bit
+//   and the 64-bit cells of the generic integers.
+//
+
+#include <cfloat>
+#include <chrono>
+#include <cstdio>
+
+#include "Numerics/Integer.h"
+#include "NumericalLattices/FloatExactBaseTypesGeneric.template"
+
+#ifndef BENCH_ITERATIONS
+#define BENCH_ITERATIONS 200000
+#endif
+
+#ifndef FLOAT_REAL_BITS_NUMBER
+#define FLOAT_REAL_BITS_NUMBER 123
+#endif
+
+namespace {
+
+template <class BaseStoreTraits>
+class BenchReal {
+  public:
+   typedef NumericalDomains::DDoubleExact::TGBuiltFloat<BaseStoreTraits,
+         FLOAT_REAL_BITS_NUMBER, FLOAT_REAL_BITS_NUMBER, 15> Real;
+   typedef typename Real::ReadParameters ReadParameters;
+
+  private:
+   static double elapsed(std::chrono::steady_clock::time_point start)
+      {  return std::chrono::duration<double, std::nano>(
+               std::chrono::steady_clock::now() - start).count() / BENCH_ITERATIONS;
+      }
+   static Real fromInt(unsigned int value)
+      {  return Real(value); }
+
+  public:
+   static void run(const char* name)
+      {  ReadParameters params;
+         params.setNearestRound();
+         params.setRoundToEven();
+         Real three = fromInt(3), seven = fromInt(7), one = fromInt(1);
+         Real ratio = one;
+         ratio.divAssign(three, params); // 1/3 has a full mantissa
+         Real alpha = seven;
+         alpha.divAssign(fromInt(5), params);
+
+         Real value = ratio;
+         auto start = std::chrono::steady_clock::now();
+         for (int iteration = 0; iteration < BENCH_ITERATIONS; ++iteration) {
+            value.multAssign(alpha, params);
+            value.multAssign(ratio, params);
+            value.plusAssign(one, params);
+         };
+         double multTime = elapsed(start);
+         unsigned int multCheck = value.getMantissa()[0] & 0xff;
+
+         value = ratio;
+         start = std::chrono::steady_clock::now();
+         for (int iteration = 0; iteration < BENCH_ITERATIONS; ++iteration) {
+            value.divAssign(alpha, params);
+            value.plusAssign(three, params);
+         };
+         double divTime = elapsed(start);
+         unsigned int divCheck = value.getMantissa()[0] & 0xff;
+
+         value = seven;
+         start = std::chrono::steady_clock::now();
+         for (int iteration = 0; iteration < BENCH_ITERATIONS; ++iteration) {
+            value.sqrtAssign(params);
+            value.plusAssign(seven, params);
+         };
+         double sqrtTime = elapsed(start);
+         unsigned int sqrtCheck = value.getMantissa()[0] & 0xff;
+
+         printf("%-10s mult %8.1f ns/op  div %8.1f ns/op  sqrt %8.1f ns/op  (%02x %02x %02x)\n",
+               name, multTime, divTime, sqrtTime, multCheck, divCheck, sqrtCheck);
+      }
+};
+
+} // end of anonymous namespace
+
+int main(int argc, char** argv) {
+   BenchReal<Numerics::UnsignedBaseStoreTraits>::run("unsigned");
+   BenchReal<Numerics::UnsignedLongBaseStoreTraits>::run("long");
+   return 0;
+}
+
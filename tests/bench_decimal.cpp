@@ -0,0 +1,158 @@
+/**************************************************************************/
+/*                                                                        */
+/*  This file is part of FLDLib                                           */
+/*                                                                        */
+/*  Copyright (C) 2014-2017                                               */
+/*    CEA (Commissariat a l'Energie Atomique et aux Energies              */
+/*         Alternatives)                                                  */
+/*                                                                        */
+/*  you can redistribute it and/or modify it under the terms of the GNU   */
+/*  Lesser General Public License as published by the Free Software       */
+/*  Foundation, version 2.1.                                              */
+/*                                                                        */
+/*  It is distributed in the hope that it will be useful,                 */
+/*  but WITHOUT ANY WARRANTY; without even the implied warranty of        */
+/*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         */
+/*  GNU Lesser General Public License for more details.                   */
+/*                                                                        */
+/*  See the GNU Lesser General Public License version 2.1                 */
+/*  for more details (enclosed in the file LICENSE).                      */
+/*                                                                        */
+/**************************************************************************/
+
+/////////////////////////////////
+//
+// Library   : tests
+// Unit      : bench
+// File      : bench_decimal.cpp
+// Description :
+//   Cost in ns/op of the decimal printing and parsing of the reals and of
+//   their mantissas for precisions from 123 to 1024 bits.
+//
+
+#include <cfloat>
+#include <chrono>
+#include <cstdio>
+#include <sstream>
+#include <string>
+
+#include "Numerics/Integer.h"
+#include "NumericalLattices/FloatExactBaseTypesGeneric.template"
+
+#ifndef BENCH_ITERATIONS
+#define BENCH_ITERATIONS 1000000
+#endif
+
+namespace {
+
+#if defined(FLOAT_GENERIC_BASE_UNSIGNED)
+typedef Numerics::UnsignedBaseStoreTraits BaseStoreTraits;
+#else
+typedef Numerics::UnsignedLongBaseStoreTraits BaseStoreTraits;
+#endif
+
+class StringStream : public STG::IOObject::OSBase {
+  private:
+   std::string sContent;
+
+  public:
+   StringStream() {}
+
+   void clear() { sContent.clear(); }
+   const std::string& content() const { return sContent; }
+   virtual OSBase& put(char ch) override { sContent.push_back(ch); return *this; }
+   virtual OSBase& write(char ch, bool) override { sContent.push_back(ch); return *this; }
+   virtual OSBase& write(int n, bool) override { sContent += std::to_string(n); return *this; }
+   virtual OSBase& writechunk(void* achunk) override
+      {  STG::TChunk<char>& chunk = *((STG::TChunk<char>*) achunk);
+         sContent.append(chunk.string, chunk.length);
+         return *this;
+      }
+};
+
+class Timer {
+  private:
+   std::chrono::steady_clock::time_point tpStart;
+
+  public:
+   Timer() : tpStart(std::chrono::steady_clock::now()) {}
+   double nanoSecondsPerOperation(int operations) const
+      {  return std::chrono::duration<double, std::nano>(
+               std::chrono::steady_clock::now() - tpStart).count() / operations;
+      }
+};
+
+template <int UBitsNumber>
+class BenchDecimal {
+  public:
+   typedef NumericalDomains::DDoubleExact::TGBuiltFloat<BaseStoreTraits,
+         UBitsNumber, UBitsNumber, 15> Real;
+   typedef typename Real::ReadParameters ReadParameters;
+   enum { UValues = 64 };
+
+   static void run()
+      {  ReadParameters params;
+         params.setNearestRound();
+         params.setRoundToEven();
+         Real values[UValues];
+         Real value(1U), alpha(7U), inverse(3U);
+         value.divAssign(Real(3U), params); // 1/3 has a full mantissa
+         alpha.divAssign(Real(5U), params);
+         inverse.divAssign(Real(11U), params);
+         for (int index = 0; index < UValues; ++index) {
+            values[index] = value;
+            value.multAssign((index % 3) ? alpha : inverse, params);
+            if (index % 5 == 0)
+               value.opposite();
+         };
+
+         StringStream out;
+         std::string texts[UValues];
+         Timer writeTimer;
+         size_t check = 0;
+         for (int iteration = 0; iteration < BENCH_ITERATIONS; ++iteration) {
+            out.clear();
+            values[iteration % UValues].writeDecimal(out);
+            check += out.content().size();
+            if (iteration < UValues)
+               texts[iteration] = out.content();
+         };
+         double writeTime = writeTimer.nanoSecondsPerOperation(BENCH_ITERATIONS);
+
+         Timer readTimer;
+         for (int iteration = 0; iteration < BENCH_ITERATIONS; ++iteration) {
+            std::istringstream text(texts[iteration % UValues]);
+            STG::IOObject::ISStream in(text);
+            Real read;
+            ReadParameters readParams;
+            readParams.setNearestRound();
+            read.read(in, readParams);
+            check += read.getMantissa()[0] & 0x1;
+         };
+         double readTime = readTimer.nanoSecondsPerOperation(BENCH_ITERATIONS);
+
+         typename Real::Mantissa::FormatParameters decimal;
+         decimal.setDecimal();
+         Timer mantissaTimer;
+         for (int iteration = 0; iteration < BENCH_ITERATIONS; ++iteration) {
+            out.clear();
+            values[iteration % UValues].getMantissa().write(out, decimal);
+            check += out.content().size();
+         };
+         double mantissaTime = mantissaTimer.nanoSecondsPerOperation(BENCH_ITERATIONS);
+
+         printf("%4d bits  write %9.1f ns/op  read %9.1f ns/op  mantissa %8.1f ns/op  (%zu)\n",
+               UBitsNumber, writeTime, readTime, mantissaTime, check);
+      }
+};
+
+} // end of anonymous namespace
+
+int main(int argc, char** argv) {
+   BenchDecimal<123>::run();
+   BenchDecimal<256>::run();
+   BenchDecimal<512>::run();
+   BenchDecimal<1024>::run();
+   return 0;
+}
+
@@ -0,0 +1,40 @@
+
+DECLARE_RESOURCES
+
+/* Benchmark: merge of unstable/unsolved branches of a sum that depends on
+   BENCH_SYMBOLS input and noise symbols. The merge reads back every term of
+   the equations and looks up each of their symbols by order.
+   Compile with -DBENCH_SYMBOLS=100000 to scale the benchmark.              */
+
+#ifndef BENCH_SYMBOLS
+#define BENCH_SYMBOLS 10000
+#endif
+
+double values[BENCH_SYMBOLS];
+
+int main() {
+  INIT_MAIN
+
+  double sum, res;
+  int i, step;
+  for (i = 0; i < BENCH_SYMBOLS; ++i)
+    values[i] = DBETWEEN(0.0, 0.1)*1.1;
+  /* pairwise summation keeps the construction in O(n log n) */
+  for (step = 1; step < BENCH_SYMBOLS; step *= 2)
+    for (i = 0; i+step < BENCH_SYMBOLS; i += 2*step)
+      values[i] = values[i] + values[i+step];
+  sum = values[0];
+
+  FLOAT_SPLIT_ALL(1, res >> double::end(), sum << double::end())
+  if (sum < 0.055*BENCH_SYMBOLS)
+    res = sum + 1.0;
+  else
+    res = sum - 1.0;
+  FLOAT_MERGE_ALL(1, res << double::end(), sum >> double::end())
+
+  DPRINT(res);
+
+  END_MAIN
+  return 0;
+}
+
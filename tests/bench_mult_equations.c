@@ -0,0 +1,39 @@
+DECLARE_RESOURCES
+
+/* Benchmark: products of affine forms that depend on BENCH_SYMBOLS noise
+   symbols. The cross terms of each product iterate over all the pairs of
+   terms of both equations.
+   Compile with -DBENCH_SYMBOLS=4000 to scale the benchmark.                */
+
+#ifndef BENCH_SYMBOLS
+#define BENCH_SYMBOLS 1000
+#endif
+
+#ifndef BENCH_PRODUCTS
+#define BENCH_PRODUCTS 8
+#endif
+
+double values[BENCH_SYMBOLS];
+
+int main() {
+  INIT_MAIN
+
+  double x, y, res;
+  int i, step;
+  for (i = 0; i < BENCH_SYMBOLS; ++i)
+    values[i] = DBETWEEN(-0.1, 0.1);
+  for (step = 1; step < BENCH_SYMBOLS; step *= 2)
+    for (i = 0; i+step < BENCH_SYMBOLS; i += 2*step)
+      values[i] = values[i] + 0.5*values[i+step];
+  x = values[0];
+  y = 1.0 - x;
+
+  res = 0.0;
+  for (i = 0; i < BENCH_PRODUCTS; ++i)
+    res = res + x*y;
+
+  DPRINT(res);
+
+  END_MAIN
+  return 0;
+}
@@ -0,0 +1,125 @@
+/**************************************************************************/
+/*                                                                        */
+/*  This file is part of FLDLib                                           */
+/*                                                                        */
+/*  Copyright (C) 2014-2017                                               */
+/*    CEA (Commissariat a l'Energie Atomique et aux Energies              */
+/*         Alternatives)                                                  */
+/*                                                                        */
+/*  you can redistribute it and/or modify it under the terms of the GNU   */
+/*  Lesser General Public License as published by the Free Software       */
+/*  Foundation, version 2.1.                                              */
+/*                                                                        */
+/*  It is distributed in the hope that it will be useful,                 */
+/*  but WITHOUT ANY WARRANTY; without even the implied warranty of        */
+/*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         */
+/*  GNU Lesser General Public License for more details.                   */
+/*                                                                        */
+/*  See the GNU Lesser General Public License version 2.1                 */
+/*  for more details (enclosed in the file LICENSE).                      */
+/*                                                                        */
+/**************************************************************************/
+
+/////////////////////////////////
+//
+// Library   : tests
+// Unit      : bench
+// File      : bench_rounding.cpp
+// Description :
+//   Cost in ns/op of the addition, the subtraction, the multiplication
+//   and the fused multiply-add of the default reals for each rounding mode.
+//
+
+#include <cfloat>
+#include <chrono>
+#include <cstdio>
+
+#include "config.h"
+#include "Numerics/Integer.h"
+#include "NumericalLattices/FloatExactBaseTypesGeneric.template"
+
+#ifndef BENCH_ITERATIONS
+#define BENCH_ITERATIONS 500000
+#endif
+
+#ifndef FLOAT_REAL_BITS_NUMBER
+#define FLOAT_REAL_BITS_NUMBER 123
+#endif
+
+namespace {
+
+#if defined(FLOAT_GENERIC_BASE_UNSIGNED)
+typedef Numerics::UnsignedBaseStoreTraits BaseStoreTraits;
+#else
+typedef Numerics::UnsignedLongBaseStoreTraits BaseStoreTraits;
+#endif
+
+typedef NumericalDomains::DDoubleExact::TGBuiltFloat<BaseStoreTraits,
+      FLOAT_REAL_BITS_NUMBER, FLOAT_REAL_BITS_NUMBER, 15> Real;
+typedef Real::ReadParameters ReadParameters;
+
+class Timer {
+  private:
+   std::chrono::steady_clock::time_point tpStart;
+
+  public:
+   Timer() : tpStart(std::chrono::steady_clock::now()) {}
+   double nanoSecondsPerOperation() const
+      {  return std::chrono::duration<double, std::nano>(
+               std::chrono::steady_clock::now() - tpStart).count() / BENCH_ITERATIONS;
+      }
+};
+
+void
+run(const char* name, ReadParameters& params) {
+   ReadParameters nearest;
+   nearest.setNearestRound();
+   nearest.setRoundToEven();
+   Real one(1U), three(3U), seven(7U);
+   Real ratio = one, alpha = seven, inverse(5U);
+   ratio.divAssign(three, nearest);
+   alpha.divAssign(Real(5U), nearest);
+   inverse.divAssign(seven, nearest);
+
+   Real value = ratio;
+   Timer plusTimer;
+   for (int iteration = 0; iteration < BENCH_ITERATIONS; ++iteration) {
+      value.plusAssign(ratio, params);
+      value.minusAssign(alpha, params);
+   };
+   double plusTime = plusTimer.nanoSecondsPerOperation()/2;
+
+   value = ratio;
+   Timer multTimer;
+   for (int iteration = 0; iteration < BENCH_ITERATIONS; ++iteration) {
+      value.multAssign(alpha, params);
+      value.multAssign(inverse, params);
+   };
+   double multTime = multTimer.nanoSecondsPerOperation()/2;
+
+   value = ratio;
+   Timer fmaTimer;
+   for (int iteration = 0; iteration < BENCH_ITERATIONS; ++iteration)
+      value.multAndAddAssign(ratio, one, params);
+   double fmaTime = fmaTimer.nanoSecondsPerOperation();
+
+   printf("%-8s plus/minus %7.1f ns/op  mult %7.1f ns/op  fma %7.1f ns/op\n",
+         name, plusTime, multTime, fmaTime);
+}
+
+} // end of anonymous namespace
+
+int main(int argc, char** argv) {
+   ReadParameters params;
+   params.setNearestRound();
+   params.setRoundToEven();
+   run("nearest", params);
+   params.setHighestRound();
+   run("highest", params);
+   params.setLowestRound();
+   run("lowest", params);
+   params.setZeroRound();
+   run("zero", params);
+   return 0;
+}
+
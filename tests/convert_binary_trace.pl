@@ -0,0 +1,122 @@
+#!/usr/bin/perl
+# convert a trace file produced with comp_float_diagnosis.sh -binary-trace
+# into a readable text file
+#   usage: convert_binary_trace.pl progname_diag_aff_out [output]
+use strict;
+use warnings;
+
+use IO::File;
+use Math::BigFloat;
+
+use autodie; # die if problem reading or writing a file
+
+my $fh_in = IO::File->new($ARGV[0], "r") or die;
+binmode($fh_in);
+my $content = do { local $/; <$fh_in> };
+undef $fh_in;
+
+my $fh_out = (defined $ARGV[1]) ? IO::File->new($ARGV[1], "w") : IO::File->new_from_fd(fileno(STDOUT), "w");
+
+my $float_tag = 0x01;
+my $equation_tag = 0x02;
+my $definition_flag = 0x80;
+my @symbol_prefixes = ("?_", "e_", "u_", "um_", "l_", "d_", "h_", "c_");
+my $position = 0;
+
+sub read_byte {
+  die "truncated binary trace\n" if $position >= length($content);
+  return ord(substr($content, $position++, 1));
+}
+
+sub read_varint {
+  my ($value, $shift, $byte) = (0, 0, 0);
+  do {
+    $byte = read_byte();
+    $value += ($byte & 0x7f) * (2 ** $shift);
+    $shift += 7;
+  } while ($byte & 0x80);
+  return $value;
+}
+
+# little endian bytes, the mantissa from the lowest bit, the sign on the
+#   highest bit with the biased exponent just below
+sub read_float {
+  die "floating point value expected\n" if read_byte() != $float_tag;
+  my $bits_mantissa = read_varint();
+  my $bits_exponent = read_varint();
+  my $byte_size = int(($bits_mantissa + $bits_exponent + 1 + 7) / 8);
+  my $chunk = Math::BigInt->new(0);
+  for (my $index = 0; $index < $byte_size; ++$index) {
+    $chunk->badd(Math::BigInt->new(read_byte())->blsft(8 * $index));
+  }
+  my $mantissa = $chunk->copy()->band(Math::BigInt->new(1)->blsft($bits_mantissa)->bsub(1));
+  my $exponent = $chunk->copy()->brsft(8 * $byte_size - 1 - $bits_exponent)
+        ->band(Math::BigInt->new(1)->blsft($bits_exponent)->bsub(1));
+  my $sign = $chunk->copy()->brsft(8 * $byte_size - 1)->is_one() ? "-" : "";
+  my $max_exponent = Math::BigInt->new(1)->blsft($bits_exponent)->bsub(1);
+  if ($exponent->bcmp($max_exponent) == 0)
+    { return $mantissa->is_zero() ? $sign . "oo" : "NaN"; }
+  return $sign . "0.0" if ($exponent->is_zero() && $mantissa->is_zero());
+  my $bias = Math::BigInt->new(1)->blsft($bits_exponent - 1)->bsub(1);
+  if ($exponent->is_zero())
+    { $exponent->binc(); }
+  else
+    { $mantissa->badd(Math::BigInt->new(1)->blsft($bits_mantissa)); }
+  my $shift = $exponent->bsub($bias)->bsub($bits_mantissa)->numify();
+  my $digits = int($bits_mantissa * log(2) / log(10)) + 1;
+  my $value = Math::BigFloat->new($mantissa);
+  $value = ($shift >= 0) ? $value->bmul(Math::BigFloat->new(2)->bpow($shift))
+        : $value->bdiv(Math::BigFloat->new(2)->bpow(-$shift), $digits + 10);
+  my ($significand, $decimal_exponent) = split(/e/, $value->bround($digits)->bsstr());
+  $decimal_exponent += length($significand) - 1;
+  $significand =~ s/0+$//;
+  $significand .= "0" if (length($significand) == 1);
+  my $result = $sign . substr($significand, 0, 1) . "." . substr($significand, 1);
+  $result .= "e" . (($decimal_exponent < 0) ? "-" : "+") . abs($decimal_exponent)
+    if ($decimal_exponent != 0);
+  return $result;
+}
+
+sub read_equation {
+  die "equation expected\n" if read_byte() != $equation_tag;
+  my $count = read_varint();
+  my $result = read_float();
+  while ($count-- > 0) {
+    my $coefficient = read_float();
+    my $type = read_byte();
+    my $order = read_varint();
+    $result .= " + " . $coefficient . "*" . $symbol_prefixes[$type & ~$definition_flag] . $order;
+    $result .= " {" . read_equation() . " }" if ($type & $definition_flag);
+  }
+  return $result;
+}
+
+# the header starts the output trace, it follows the path condition in the input trace
+sub skip_header {
+  return 0 if substr($content, $position, 4) ne "FLDT";
+  die "unsupported version of the binary trace\n" if substr($content, $position+4, 1) ne "\x01";
+  $position += 5;
+  read_varint();
+  die "unexpected binary trace header\n" if read_byte() != ord("\n");
+  return 1;
+}
+
+my $text = "";
+while ($position < length($content)) {
+  next if (($position == 0 || substr($content, $position-1, 1) eq "\n") && skip_header());
+  my $byte = ord(substr($content, $position, 1));
+  if ($byte == $float_tag)
+    { $text .= read_float(); }
+  elsif ($byte == $equation_tag)
+    { $text .= read_equation(); }
+  else {
+    $text .= chr($byte);
+    ++$position;
+  }
+  if (length($text) >= 65536) {
+    $fh_out->print($text);
+    $text = "";
+  }
+}
+$fh_out->print($text);
+undef $fh_out;
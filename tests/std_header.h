@@ -69,6 +69,14 @@
 #define FLOAT_INIT_BACKTRACE 
 #endif
 
+#if defined(FLOAT_ALL_PATHS) && !defined(FLOAT_LOOP_UNSTABLE)
+#define FLOAT_BEGIN_ALL_PATHS init.runAllPaths([&]() -> int { srand(1);
+#define FLOAT_END_ALL_PATHS return 0; });
+#else
+#define FLOAT_BEGIN_ALL_PATHS 
+#define FLOAT_END_ALL_PATHS 
+#endif
+
 #ifdef FLOAT_AFFINE
 #ifdef FLOAT_SCENARIO
 #define FLOAT_PROG_SUFFIX "_scenario"
@@ -94,12 +102,24 @@
 #define FLOAT_INIT_TRACK 
 #endif
 
+#ifdef FLOAT_BINARY_TRACE
+#define FLOAT_INIT_BINARY_TRACE init.setSupportBinaryTrace();
+#else
+#define FLOAT_INIT_BINARY_TRACE 
+#endif
+
 #ifdef FLOAT_LIMIT_NOISE_SYMBOLS_NUMBER
 #define FLOAT_INIT_LIMIT_NOISE_SYMBOLS_NUMBER init.setLimitNoiseSymbolsNumber(FLOAT_LIMIT_NOISE_SYMBOLS_NUMBER);
 #else
 #define FLOAT_INIT_LIMIT_NOISE_SYMBOLS_NUMBER 
 #endif
 
+#if defined(FLOAT_JOBS) && !defined(FLOAT_INTERFACE)
+#define FLOAT_INIT_JOBS init.setJobsNumber(FLOAT_JOBS);
+#else
+#define FLOAT_INIT_JOBS 
+#endif
+
 #ifdef FLOAT_MAP_SYMBOLS
 #define FLOAT_INIT_MAP_SYMBOLS(filename) init.setSupportMapSymbols(filename);
 #else
@@ -116,9 +136,11 @@
   FLOAT_INIT_FIRST_FOLLOW_EXE                                                                    \
   FLOAT_INIT_SIMPLIFICATION                                                                      \
   FLOAT_INIT_LIMIT_NOISE_SYMBOLS_NUMBER                                                          \
+  FLOAT_INIT_JOBS                                                                                \
   FLOAT_INIT_PURE_ZONOTOPE                                                                       \
   FLOAT_INIT_BACKTRACE                                                                           \
   FLOAT_INIT_TRACK                                                                               \
+  FLOAT_INIT_BINARY_TRACE                                                                        \
   init.setResultFile(TOSTRING(PROG_NAME) "_diag_aff" FLOAT_PROG_SUFFIX);                         \
   FLOAT_INIT_MAP_SYMBOLS(TOSTRING(PROG_NAME) FLOAT_PROG_SUFFIX "_map")                           \
   std::cout << FLOAT_INIT_MESSAGE << std::endl;                                                  \
@@ -150,12 +172,15 @@
   FLOAT_INIT_FIRST_FOLLOW_EXE                                                                    \
   FLOAT_INIT_SIMPLIFICATION                                                                      \
   FLOAT_INIT_LIMIT_NOISE_SYMBOLS_NUMBER                                                          \
+  FLOAT_INIT_JOBS                                                                                \
   FLOAT_INIT_PURE_ZONOTOPE                                                                       \
   FLOAT_INIT_BACKTRACE                                                                           \
   FLOAT_INIT_TRACK                                                                               \
+  FLOAT_INIT_BINARY_TRACE                                                                        \
   init.setResultFile(TOSTRING(PROG_NAME) "_diag_aff" FLOAT_PROG_SUFFIX);                         \
   FLOAT_INIT_MAP_SYMBOLS(TOSTRING(PROG_NAME) FLOAT_PROG_SUFFIX "_map")                           \
   std::cout << FLOAT_INIT_MESSAGE << std::endl;                                                  \
+  FLOAT_BEGIN_ALL_PATHS                                                                          \
   try {
 #define END_MAIN                                                                                 \
   }                                                                                              \
@@ -168,7 +193,8 @@
   }                                                                                              \
   catch (FLOAT_PRECONDITION_ERROR& error) {                                                      \
       error.print(std::cout);                                                                    \
-  }
+  }                                                                                              \
+  FLOAT_END_ALL_PATHS
 
 #endif // FLOAT_LOOP_UNSTABLE
 
@@ -241,9 +267,11 @@ static inline NumericalDomains::DoubleZonotope middle_of_double_with_error(old_d
   FLOAT_INIT_BACKTRACE                                                                           \
   init.setResultFile(TOSTRING(PROG_NAME) "_diag_int");                                           \
   std::cout << FLOAT_INIT_MESSAGE << std::endl;                                                  \
+  FLOAT_BEGIN_ALL_PATHS                                                                          \
   FLOAT_SPLIT_ALL(main, double::end(), double::end())
 #define END_MAIN                                                                                 \
-  FLOAT_MERGE_ALL(main, double::end(), double::endl())
+  FLOAT_MERGE_ALL(main, double::end(), double::endl())                                           \
+  FLOAT_END_ALL_PATHS
 #else // FLOAT_LOOP_UNSTABLE
 #define INIT_MAIN                                                                                \
   NumericalDomains::FloatInterval::Initialization init;                                          \
@@ -304,6 +332,7 @@ static inline NumericalDomains::DoubleZonotope middle_of_double_with_error(old_d
   FLOAT_INIT_BACKTRACE                                                                           \
   init.setResultFile(TOSTRING(PROG_NAME) "_diag_exact");                                         \
   std::cout << FLOAT_INIT_MESSAGE << std::endl;                                                  \
+  FLOAT_BEGIN_ALL_PATHS                                                                          \
   try {
 #define END_MAIN                                                                                 \
   }                                                                                              \
@@ -316,7 +345,8 @@ static inline NumericalDomains::DoubleZonotope middle_of_double_with_error(old_d
   }                                                                                              \
   catch (FLOAT_PRECONDITION_ERROR& error) {                                                      \
       error.print(std::cout);                                                                    \
-  }
+  }                                                                                              \
+  FLOAT_END_ALL_PATHS
 #endif // FLOAT_LOOP_UNSTABLE
 
 #undef FBETWEEN
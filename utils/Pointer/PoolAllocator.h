@@ -0,0 +1,156 @@
+/**************************************************************************/
+/*                                                                        */
+/*  This file is part of FLDLib                                           */
+/*                                                                        */
+/*  Copyright (C) 2013-2017                                               */
+/*    CEA (Commissariat a l'Energie Atomique et aux Energies              */
+/*         Alternatives)                                                  */
+/*                                                                        */
+/*  you can redistribute it and/or modify it under the terms of the GNU   */
+/*  Lesser General Public License as published by the Free Software       */
+/*  Foundation, version 2.1.                                              */
+/*                                                                        */
+/*  It is distributed in the hope that it will be useful,                 */
+/*  but WITHOUT ANY WARRANTY; without even the implied warranty of        */
+/*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         */
+/*  GNU Lesser General Public License for more details.                   */
+/*                                                                        */
+/*  See the GNU Lesser General Public License version 2.1                 */
+/*  for more details (enclosed in the file LICENSE).                      */
+/*                                                                        */
+/**************************************************************************/
+
+/////////////////////////////////
+//
+// Library   : Pointer
+// Unit      : Allocation
+// File      : PoolAllocator.h
+// Description :
+//   Definition of a size-class pool for small objects that are frequently
+//   allocated and freed like the coefficients of the affine forms and the symbols.
+//
+
+#ifndef PNT_PoolAllocatorH
+#define PNT_PoolAllocatorH
+
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+namespace PNT {
+
+/*******************************/
+/* Definition of SizeClassPool */
+/*******************************/
+
+class SizeClassPool {
+  public:
+   static const size_t UGranularity = 16;
+   static const size_t UMaxClassSize = 512;
+   static const size_t UChunkSize = 64*1024;
+
+   class Counters {
+     public:
+      unsigned long ulAllocations;   // all the requests
+      unsigned long ulDeallocations;
+      unsigned long ulRecycled;      // requests served by a free list
+      unsigned long ulLarge;         // requests above UMaxClassSize given to malloc
+      unsigned long ulChunks;
+      unsigned long ulLive;
+      unsigned long ulPeak;
+
+      Counters()
+         :  ulAllocations(0), ulDeallocations(0), ulRecycled(0), ulLarge(0), ulChunks(0),
+            ulLive(0), ulPeak(0) {}
+   };
+
+  private:
+   struct FreeCell { FreeCell* pfcNext; };
+   struct Chunk { Chunk* pcNext; };
+
+   FreeCell* apfcFreeLists[UMaxClassSize/UGranularity];
+   Chunk* pcChunks;
+   char* pcCurrent;
+   char* pcEnd;
+   Counters cCounters;
+
+   static size_t queryClass(size_t size) { return (size + UGranularity-1)/UGranularity - 1; }
+   char* newChunk()
+      {  Chunk* chunk = (Chunk*) malloc(UChunkSize);
+         if (!chunk)
+            throw std::bad_alloc();
+         chunk->pcNext = pcChunks;
+         pcChunks = chunk;
+         ++cCounters.ulChunks;
+         pcEnd = (char*) chunk + UChunkSize;
+         return (char*) chunk + UGranularity;
+      }
+
+  public:
+   SizeClassPool() : pcChunks(nullptr), pcCurrent(nullptr), pcEnd(nullptr)
+      {  for (size_t index = 0; index < UMaxClassSize/UGranularity; ++index)
+            apfcFreeLists[index] = nullptr;
+      }
+   SizeClassPool(const SizeClassPool&) = delete;
+   SizeClassPool& operator=(const SizeClassPool&) = delete;
+   ~SizeClassPool()
+      {  while (pcChunks) {
+            Chunk* next = pcChunks->pcNext;
+            free(pcChunks);
+            pcChunks = next;
+         };
+      }
+
+   void* allocate(size_t size)
+      {  ++cCounters.ulAllocations;
+         if (++cCounters.ulLive > cCounters.ulPeak)
+            cCounters.ulPeak = cCounters.ulLive;
+         if (size > UMaxClassSize) {
+            ++cCounters.ulLarge;
+            void* result = malloc(size);
+            if (!result)
+               throw std::bad_alloc();
+            return result;
+         };
+         size_t sizeClass = queryClass(size);
+         if (FreeCell* result = apfcFreeLists[sizeClass]) {
+            apfcFreeLists[sizeClass] = result->pfcNext;
+            ++cCounters.ulRecycled;
+            return result;
+         };
+         size_t cellSize = (sizeClass+1)*UGranularity;
+         if (!pcCurrent || pcCurrent + cellSize > pcEnd)
+            pcCurrent = newChunk();
+         void* result = pcCurrent;
+         pcCurrent += cellSize;
+         return result;
+      }
+   void deallocate(void* pointer, size_t size)
+      {  if (!pointer)
+            return;
+         ++cCounters.ulDeallocations;
+         --cCounters.ulLive;
+         if (size > UMaxClassSize) {
+            free(pointer);
+            return;
+         };
+         size_t sizeClass = queryClass(size);
+         FreeCell* cell = (FreeCell*) pointer;
+         cell->pfcNext = apfcFreeLists[sizeClass];
+         apfcFreeLists[sizeClass] = cell;
+      }
+   const Counters& counters() const { return cCounters; }
+
+#include "StandardClasses/UndefineNew.h"
+   // never destroyed since coefficients and symbols may be freed by other static objects
+   static SizeClassPool& global()
+      {  static SizeClassPool* pool = new SizeClassPool();
+         return *pool;
+      }
+#include "StandardClasses/DefineNew.h"
+};
+
+} // end of namespace PNT
+
+#endif // PNT_PoolAllocatorH
+
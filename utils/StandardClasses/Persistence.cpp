@@ -31,6 +31,12 @@
 //
 
 #include "StandardClasses/Persistence.h"
+#include <cerrno>
+#include <cstdlib>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 
 namespace STG {
 
@@ -65,6 +71,193 @@ EWriteError::EWriteError(const char* message)
 #include "StandardClasses/IOStreamMethods.incc"
 #undef DefineLinkStream
 #undef DefineTypeObject
+#undef DefineImplementsOStreamMethods
+
+   /* class IFMappedStream */
+
+IOObject::IFMappedStream::Buffer::Buffer(const char* fileName)
+   :  szContent(nullptr), uSize(0), fMapped(false), fOpen(false) {
+   int file = ::open(fileName, O_RDONLY);
+   struct stat status;
+   if (file < 0 || fstat(file, &status) < 0) {
+      if (file >= 0)
+         ::close(file);
+      return;
+   };
+   if (S_ISREG(status.st_mode) && status.st_size > 0) {
+      void* content = mmap(nullptr, (size_t) status.st_size, PROT_READ, MAP_PRIVATE, file, 0);
+      if (content != MAP_FAILED) {
+         szContent = (char*) content;
+         uSize = (size_t) status.st_size;
+         fMapped = true;
+#ifdef POSIX_MADV_SEQUENTIAL
+         posix_madvise(content, uSize, POSIX_MADV_SEQUENTIAL);
+#endif
+      };
+   };
+   if (!fMapped) { // pipes or special files are read at once
+      size_t capacity = 0;
+      ssize_t readSize;
+      do {
+         if (uSize == capacity) {
+            capacity = capacity ? 2*capacity : 65536;
+            char* newContent = (char*) realloc(szContent, capacity);
+            if (!newContent) {
+               readSize = -1;
+               break;
+            };
+            szContent = newContent;
+         };
+         readSize = ::read(file, szContent + uSize, capacity - uSize);
+         if (readSize > 0)
+            uSize += (size_t) readSize;
+      } while (readSize > 0 || (readSize < 0 && errno == EINTR));
+      if (readSize < 0) {
+         if (szContent)
+            free(szContent);
+         szContent = nullptr;
+         uSize = 0;
+         ::close(file);
+         return;
+      };
+   };
+   ::close(file);
+   fOpen = true;
+   if (szContent)
+      setg(szContent, szContent, szContent + uSize);
+}
+
+IOObject::IFMappedStream::Buffer::~Buffer() {
+   if (szContent) {
+      if (fMapped)
+         munmap(szContent, uSize);
+      else
+         free(szContent);
+   };
+}
+
+IOObject::IFMappedStream::Buffer::pos_type
+IOObject::IFMappedStream::Buffer::seekoff(off_type offset, std::ios_base::seekdir origin,
+      std::ios_base::openmode mode) {
+   if (!(mode & std::ios_base::in) || !fOpen)
+      return pos_type(off_type(-1));
+   off_type position = offset;
+   if (origin == std::ios_base::cur)
+      position += gptr() - eback();
+   else if (origin == std::ios_base::end)
+      position += (off_type) uSize;
+   if (position < 0 || position > (off_type) uSize)
+      return pos_type(off_type(-1));
+   if (szContent)
+      setg(szContent, szContent + position, szContent + uSize);
+   return pos_type(position);
+}
+
+   /* class OFBufferedStream */
+
+IOObject::OFBufferedStream::Buffer::Buffer(const char* fileName, std::ios_base::openmode mode)
+   :  uFile(-1), szBuffer(nullptr), uFlushedSize(0) {
+   int flags = O_WRONLY | O_CREAT | ((mode & std::ios_base::app) ? O_APPEND : O_TRUNC);
+   uFile = ::open(fileName, flags, 0666);
+   if (uFile >= 0) {
+      szBuffer = new char[UBufferSize];
+      setp(szBuffer, szBuffer + UBufferSize);
+   };
+}
+
+bool
+IOObject::OFBufferedStream::Buffer::writeAll(const char* content, size_t size) {
+   while (size > 0) {
+      ssize_t written = ::write(uFile, content, size);
+      if (written < 0) {
+         if (errno == EINTR)
+            continue;
+         return false;
+      };
+      content += written;
+      size -= (size_t) written;
+      uFlushedSize += (long int) written;
+   };
+   return true;
+}
+
+int
+IOObject::OFBufferedStream::Buffer::sync() {
+   if (uFile < 0)
+      return -1;
+   bool result = writeAll(pbase(), (size_t) (pptr() - pbase()));
+   setp(szBuffer, szBuffer + UBufferSize);
+   return result ? 0 : -1;
+}
+
+IOObject::OFBufferedStream::Buffer::int_type
+IOObject::OFBufferedStream::Buffer::overflow(int_type ch) {
+   if (sync() != 0)
+      return traits_type::eof();
+   if (!traits_type::eq_int_type(ch, traits_type::eof())) {
+      *pptr() = traits_type::to_char_type(ch);
+      pbump(1);
+   };
+   return traits_type::not_eof(ch);
+}
+
+std::streamsize
+IOObject::OFBufferedStream::Buffer::xsputn(const char* content, std::streamsize size) {
+   if (uFile < 0)
+      return 0;
+   if (size <= epptr() - pptr()) {
+      memcpy(pptr(), content, (size_t) size);
+      pbump((int) size);
+      return size;
+   };
+   // large chunks bypass the buffer
+   if (sync() != 0)
+      return 0;
+   if (size < (std::streamsize) UBufferSize) {
+      memcpy(pptr(), content, (size_t) size);
+      pbump((int) size);
+      return size;
+   };
+   return writeAll(content, (size_t) size) ? size : 0;
+}
+
+IOObject::OFBufferedStream::Buffer::pos_type
+IOObject::OFBufferedStream::Buffer::seekoff(off_type offset, std::ios_base::seekdir origin,
+      std::ios_base::openmode mode) {
+   // only the position query tellp is supported
+   if (uFile < 0 || offset != 0 || origin != std::ios_base::cur || !(mode & std::ios_base::out))
+      return pos_type(off_type(-1));
+   return pos_type(off_type(uFlushedSize + (pptr() - pbase())));
+}
+
+bool
+IOObject::OFBufferedStream::Buffer::close() {
+   if (uFile < 0)
+      return true;
+   bool result = sync() == 0;
+   if (::close(uFile) < 0)
+      result = false;
+   uFile = -1;
+   delete [] szBuffer;
+   szBuffer = nullptr;
+   setp(nullptr, nullptr);
+   return result;
+}
+
+#define DefineImplementsIStreamMethods
+#define DefineTypeObject IOObject::IFMappedStream
+#define DefineLinkStream isIn
+#include "StandardClasses/IOStreamMethods.incc"
+#undef DefineLinkStream
+#undef DefineTypeObject
+#undef DefineImplementsIStreamMethods
+
+#define DefineImplementsOStreamMethods
+#define DefineTypeObject IOObject::OFBufferedStream
+#define DefineLinkStream osOut
+#include "StandardClasses/IOStreamMethods.incc"
+#undef DefineLinkStream
+#undef DefineTypeObject
 #undef DefineImplementsOStreamMethods
 
 } // end of namespace STG
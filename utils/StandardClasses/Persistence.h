@@ -244,6 +244,19 @@ class IOObject : public EnhancedObject {
             };
             return *this;
          }
+      ISBase& readvarint(unsigned long int& value)
+         {  // 7 bits per byte, the high bit announces a following byte
+            value = 0;
+            int shift = 0, ch;
+            do {
+               ch = get();
+               if (ch == EOF || shift >= (int) (8*sizeof(unsigned long int)))
+                  throw EReadError();
+               value |= (unsigned long int) (ch & 0x7f) << shift;
+               shift += 7;
+            } while (ch & 0x80);
+            return *this;
+         }
    };
 #ifdef HasDefinedEOF
 #undef HasDefinedEOF
@@ -302,6 +315,13 @@ class IOObject : public EnhancedObject {
       virtual OSBase& flush() { return *this; } 
       OSBase& writeint(char state, bool isRaw=false)
          {  return isRaw ? write(state, isRaw) : write((int) state, isRaw); }
+      OSBase& writevarint(unsigned long int value)
+         {  while (value >= 0x80) {
+               put((char) ((value & 0x7f) | 0x80));
+               value >>= 7;
+            };
+            return put((char) value);
+         }
    };
 
    class ISStream : public ISBase {
@@ -334,6 +354,9 @@ class IOObject : public EnhancedObject {
       #undef DefineDeclareOMethods
    };
 
+   class IFMappedStream;
+   class OFBufferedStream;
+
   protected:
    virtual void _read(ISBase& /* in */, const FormatParameters& /* params */) {}
    virtual void _write(OSBase& /* out */, const FormatParameters& /* params */) const {}
@@ -371,6 +394,126 @@ class IOObject : public EnhancedObject {
 
 #undef DefineInlineOStreamMethods
 
+/* Definition of the file streams with a large internal buffer */
+
+class IOObject::IFMappedStream final : public IOObject::ISBase {
+  public:
+   typedef IOObject::ISBase ISBase;
+
+  private:
+   // the whole file is mapped in memory (or read at once if it cannot be mapped)
+   class Buffer : public std::streambuf {
+     private:
+      char* szContent;
+      size_t uSize;
+      bool fMapped;
+      bool fOpen;
+
+     protected:
+      virtual pos_type seekoff(off_type offset, std::ios_base::seekdir origin,
+            std::ios_base::openmode mode);
+      virtual pos_type seekpos(pos_type position, std::ios_base::openmode mode)
+         {  return seekoff(off_type(position), std::ios_base::beg, mode); }
+
+     public:
+      Buffer(const char* fileName);
+      Buffer(const Buffer&) = delete;
+      virtual ~Buffer();
+
+      bool isOpen() const { return fOpen; }
+   };
+
+   Buffer bContent;
+   std::istream isIn;
+
+  public:
+   IFMappedStream(const char* fileName) : bContent(fileName), isIn(&bContent)
+      {  if (!bContent.isOpen()) isIn.setstate(std::ios_base::failbit); }
+   IFMappedStream(const char* fileName, std::ios_base::openmode /* mode */)
+      :  bContent(fileName), isIn(&bContent)
+      {  if (!bContent.isOpen()) isIn.setstate(std::ios_base::failbit); }
+   IFMappedStream(const IFMappedStream& source) = delete;
+
+   bool isValid() const { return true; }
+   virtual bool isStreamBased() const { return true; }
+   std::istream& inputStream() { return isIn; }
+   #define DefineDeclareIMethods
+   #include "StandardClasses/IOStreamMethods.inch"
+   #undef DefineDeclareIMethods
+};
+
+class IOObject::OFBufferedStream final : public IOObject::OSBase {
+  public:
+   typedef IOObject::OSBase OSBase;
+   enum { UBufferSize = 1 << 20 };
+
+  private:
+   // the content is written to the file only when the buffer is full or on flush
+   class Buffer : public std::streambuf {
+     private:
+      int uFile;
+      char* szBuffer;
+      long int uFlushedSize;
+
+      bool writeAll(const char* content, size_t size);
+
+     protected:
+      virtual int_type overflow(int_type ch);
+      virtual std::streamsize xsputn(const char* content, std::streamsize size);
+      virtual int sync();
+      virtual pos_type seekoff(off_type offset, std::ios_base::seekdir origin,
+            std::ios_base::openmode mode);
+
+     public:
+      Buffer(const char* fileName, std::ios_base::openmode mode);
+      Buffer(const Buffer&) = delete;
+      virtual ~Buffer() { close(); }
+
+      bool isOpen() const { return uFile >= 0; }
+      bool close();
+   };
+
+   Buffer bContent;
+   std::ostream osOut;
+
+  public:
+   OFBufferedStream(const char* fileName)
+      :  bContent(fileName, std::ios_base::out), osOut(&bContent)
+      {  if (!bContent.isOpen()) osOut.setstate(std::ios_base::failbit); }
+   OFBufferedStream(const char* fileName, std::ios_base::openmode mode)
+      :  bContent(fileName, mode), osOut(&bContent)
+      {  if (!bContent.isOpen()) osOut.setstate(std::ios_base::failbit); }
+   OFBufferedStream(const OFBufferedStream& source) = delete;
+
+   bool isValid() const { return true; }
+   void close() { if (!bContent.close()) osOut.setstate(std::ios_base::badbit); }
+   virtual bool isStreamBased() const { return true; }
+   std::ostream& outputStream() { return osOut; }
+   #define DefineDeclareOMethods
+   #include "StandardClasses/IOStreamMethods.inch"
+   #undef DefineDeclareOMethods
+};
+
+#define DefineInlineIStreamMethods
+
+#define DefineTypeObject IOObject::IFMappedStream
+#define DefineLinkStream isIn
+#include "StandardClasses/IOStreamMethods.inch"
+#undef DefineLinkStream
+#undef DefineTypeObject
+
+#undef DefineInlineIStreamMethods
+
+#define DefineInlineOStreamMethods
+
+#define DefineTypeObject IOObject::OFBufferedStream
+#define DefineLinkStream osOut
+#include "StandardClasses/IOStreamMethods.inch"
+#undef DefineLinkStream
+#undef DefineTypeObject
+
+#undef DefineInlineOStreamMethods
+
 namespace Lexer {
 
 class Base {